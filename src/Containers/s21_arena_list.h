@@ -0,0 +1,655 @@
+#ifndef S21_ARENA_LIST_H
+#define S21_ARENA_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// Doubly linked list whose nodes live in one contiguous slab and link to
+// each other by 32-bit slot indices instead of pointers. Slot 0 is the
+// sentinel; erased slots go onto a free list and are reused first, so
+// allocating a node is O(1) and nodes stay close together. clear() keeps
+// the slab and only resets it, which is O(1) for trivially destructible
+// elements. Growing the slab moves the elements: iterators stay valid,
+// references and pointers to elements do not. Iterators hold their list
+// and a slot index, so unlike std::list, swap and move construction or
+// assignment invalidate them, while references stay valid.
+template <typename T, typename Allocator = std::allocator<T>>
+class arena_list {
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using index_type = uint32_t;
+
+ private:
+  static constexpr index_type kSentinel = 0;
+  static constexpr size_type kMinSlots = 16;
+
+  struct Node {
+    index_type next;
+    index_type prev;
+    alignas(value_type) unsigned char storage[sizeof(value_type)];
+  };
+
+  using node_allocator_type = typename std::allocator_traits<
+      allocator_type>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator_type>;
+
+  class ArenaListIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+
+    explicit ArenaListIterator(const arena_list *list = nullptr,
+                               index_type index = kSentinel)
+        : list_(list), index_(index) {}
+
+    reference operator*() const noexcept { return list_->Value(index_); }
+    value_type *operator->() const noexcept { return &**this; }
+
+    bool operator!=(const ArenaListIterator &rhs) const noexcept {
+      return index_ != rhs.index_ || list_ != rhs.list_;
+    }
+    bool operator==(const ArenaListIterator &rhs) const noexcept {
+      return index_ == rhs.index_ && list_ == rhs.list_;
+    }
+
+    ArenaListIterator operator++(int) noexcept {
+      ArenaListIterator temp = *this;
+      ++*this;
+      return temp;
+    }
+    ArenaListIterator &operator++() noexcept {
+      index_ = list_->nodes_[index_].next;
+      return *this;
+    }
+
+    ArenaListIterator operator--(int) noexcept {
+      ArenaListIterator temp = *this;
+      --*this;
+      return temp;
+    }
+    ArenaListIterator &operator--() noexcept {
+      index_ = list_->nodes_[index_].prev;
+      return *this;
+    }
+
+    index_type GetIndex() const noexcept { return index_; }
+
+   private:
+    const arena_list *list_ = nullptr;
+    index_type index_ = kSentinel;
+  };
+
+ public:
+  using iterator = ArenaListIterator;
+  using const_iterator = const ArenaListIterator;
+
+  arena_list() noexcept : arena_list(allocator_type()) {}
+
+  explicit arena_list(const allocator_type &alloc) noexcept
+      : alloc_(alloc),
+        nodes_(nullptr),
+        capacity_(0),
+        used_(0),
+        free_(kSentinel),
+        size_(0) {}
+
+  explicit arena_list(size_type n,
+                      const allocator_type &alloc = allocator_type())
+      : arena_list(alloc) {
+    if (n >= max_size()) {
+      throw std::out_of_range("Out of container's limit");
+    }
+
+    reserve(n);
+    for (size_type i = 0; i < n; ++i) {
+      emplace_back();
+    }
+  }
+
+  arena_list(const std::initializer_list<value_type> &items,
+             const allocator_type &alloc = allocator_type())
+      : arena_list(alloc) {
+    reserve(items.size());
+    for (const T &item : items) {
+      push_back(item);
+    }
+  }
+
+  arena_list(const arena_list &l)
+      : arena_list(node_traits::select_on_container_copy_construction(
+            l.alloc_)) {
+    CopyFrom(l);
+  }
+
+  arena_list(arena_list &&l) noexcept : arena_list(std::move(l.alloc_)) {
+    SwapSlabs(l);
+  }
+
+  ~arena_list() noexcept {
+    clear();
+    FreeSlab();
+  }
+
+  arena_list &operator=(const arena_list &l) {
+    if (this != &l) {
+      clear();
+
+      if (node_traits::propagate_on_container_copy_assignment::value &&
+          alloc_ != l.alloc_) {
+        FreeSlab();
+        alloc_ = l.alloc_;
+      }
+
+      CopyFrom(l);
+    }
+
+    return *this;
+  }
+
+  arena_list &operator=(arena_list &&l) noexcept(
+      node_traits::propagate_on_container_move_assignment::value ||
+      node_traits::is_always_equal::value) {
+    if (this != &l) {
+      clear();
+
+      if (node_traits::propagate_on_container_move_assignment::value ||
+          alloc_ == l.alloc_) {
+        FreeSlab();
+
+        if (node_traits::propagate_on_container_move_assignment::value) {
+          alloc_ = std::move(l.alloc_);
+        }
+
+        SwapSlabs(l);
+      } else {
+        for (iterator it = l.begin(); it != l.end(); ++it) {
+          emplace_back(std::move(*it));
+        }
+
+        l.clear();
+      }
+    }
+
+    return *this;
+  }
+
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(alloc_);
+  }
+
+  // Element access
+  const_reference front() const noexcept { return Value(Link(kSentinel)); }
+
+  const_reference back() const noexcept {
+    return Value(nodes_[kSentinel].prev);
+  }
+
+  // Iterators
+  iterator begin() const noexcept { return iterator(this, Link(kSentinel)); }
+
+  iterator end() const noexcept { return iterator(this, kSentinel); }
+
+  // Capacity
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept {
+    size_type by_index = std::numeric_limits<index_type>::max() - 1;
+    size_type by_bytes =
+        (std::numeric_limits<size_type>::max() / sizeof(Node)) / 2;
+    return by_index < by_bytes ? by_index : by_bytes;
+  }
+
+  // Number of elements the slab holds before it has to grow.
+  size_type capacity() const noexcept {
+    return capacity_ == 0 ? 0 : capacity_ - 1;
+  }
+
+  void reserve(size_type n) {
+    if (n > max_size()) {
+      throw std::length_error("Out of container's limit");
+    }
+
+    if (n + 1 > capacity_) {
+      Reallocate(n + 1);
+    }
+  }
+
+  // Modifiers
+  // Destroys the elements and resets the slab without releasing it.
+  void clear() noexcept {
+    if (nodes_ == nullptr) {
+      return;
+    }
+
+    if (!std::is_trivially_destructible<value_type>::value) {
+      for (index_type i = Link(kSentinel); i != kSentinel;
+           i = nodes_[i].next) {
+        Value(i).~value_type();
+      }
+    }
+
+    nodes_[kSentinel].next = nodes_[kSentinel].prev = kSentinel;
+    used_ = 1;
+    free_ = kSentinel;
+    size_ = 0;
+  }
+
+  iterator insert(iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  iterator insert(iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  // Constructs the element in place in a free slot in front of pos. The
+  // value is built before the slab may grow, so arguments referring to
+  // elements of this list stay valid.
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    if (free_ == kSentinel && used_ == capacity_) {
+      value_type value(std::forward<Args>(args)...);
+      Grow();
+      return Place(pos.GetIndex(), std::move(value));
+    }
+
+    return Place(pos.GetIndex(), std::forward<Args>(args)...);
+  }
+
+  void erase(iterator pos) {
+    if (pos == end()) {
+      throw std::invalid_argument("End or empty");
+    }
+
+    EraseSlot(pos.GetIndex());
+  }
+
+  void push_back(const_reference value) { emplace(end(), value); }
+
+  void push_back(value_type &&value) { emplace(end(), std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    return *emplace(end(), std::forward<Args>(args)...);
+  }
+
+  void pop_back() noexcept {
+    if (!empty()) {
+      EraseSlot(nodes_[kSentinel].prev);
+    }
+  }
+
+  void push_front(const_reference value) { emplace(begin(), value); }
+
+  void push_front(value_type &&value) { emplace(begin(), std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_front(Args &&...args) {
+    return *emplace(begin(), std::forward<Args>(args)...);
+  }
+
+  void pop_front() noexcept {
+    if (!empty()) {
+      EraseSlot(nodes_[kSentinel].next);
+    }
+  }
+
+  // Exchanges the slabs. References stay valid; iterators into either list
+  // do not, as they name their list.
+  void swap(arena_list &other) noexcept {
+    if (node_traits::propagate_on_container_swap::value) {
+      std::swap(alloc_, other.alloc_);
+    }
+
+    SwapSlabs(other);
+  }
+
+  // Operations
+  void merge(arena_list &other) { merge(other, std::less<>()); }
+
+  // Merges the sorted other into this sorted list; on ties elements of this
+  // list come first. The elements of other are moved into this slab.
+  template <typename Compare>
+  void merge(arena_list &other, Compare comp) {
+    if (this == &other || other.empty()) {
+      return;
+    }
+
+    reserve(size_ + other.size_);
+
+    iterator pos = begin();
+    for (iterator it = other.begin(); it != other.end(); ++it) {
+      while (pos != end() && !comp(*it, *pos)) {
+        ++pos;
+      }
+      emplace(pos, std::move(*it));
+    }
+
+    other.clear();
+  }
+
+  // Moves the elements of other in front of pos. Within one list this only
+  // relinks slots; between lists the elements are moved into this slab.
+  void splice(const_iterator pos, arena_list &other) {
+    splice(pos, other, other.begin(), other.end());
+  }
+
+  void splice(const_iterator pos, arena_list &other, const_iterator it) {
+    splice(pos, other, it, std::next(it));
+  }
+
+  void splice(const_iterator pos, arena_list &other, const_iterator first,
+              const_iterator last) {
+    if (first == last) {
+      return;
+    }
+
+    if (this != &other) {
+      for (iterator it = first; it != last;) {
+        iterator next = std::next(it);
+        emplace(pos, std::move(*it));
+        other.EraseSlot(it.GetIndex());
+        it = next;
+      }
+      return;
+    }
+
+    index_type target = pos.GetIndex();
+    index_type head = first.GetIndex();
+    index_type stop = last.GetIndex();
+    if (target == head || target == stop) {
+      return;
+    }
+
+    index_type tail = nodes_[stop].prev;
+    nodes_[nodes_[head].prev].next = stop;
+    nodes_[stop].prev = nodes_[head].prev;
+
+    index_type before = nodes_[target].prev;
+    nodes_[head].prev = before;
+    nodes_[tail].next = target;
+    nodes_[before].next = head;
+    nodes_[target].prev = tail;
+  }
+
+  void reverse() noexcept {
+    if (nodes_ == nullptr) {
+      return;
+    }
+
+    index_type current = kSentinel;
+
+    do {
+      std::swap(nodes_[current].next, nodes_[current].prev);
+      current = nodes_[current].prev;
+    } while (current != kSentinel);
+  }
+
+  void unique() noexcept {
+    if (size_ <= 1) {
+      return;
+    }
+
+    index_type current = nodes_[kSentinel].next;
+
+    while (nodes_[current].next != kSentinel) {
+      index_type next = nodes_[current].next;
+      if (Value(current) == Value(next)) {
+        EraseSlot(next);
+      } else {
+        current = next;
+      }
+    }
+  }
+
+  void sort() { sort(std::less<>()); }
+
+  // Stable bottom-up merge sort that only rewrites slot indices. The ring
+  // is already terminated by the sentinel index, which doubles as the end
+  // marker of every run.
+  template <typename Compare>
+  void sort(Compare comp) {
+    if (size_ <= 1) {
+      return;
+    }
+
+    for (size_type width = 1; width < size_; width *= 2) {
+      index_type rest = nodes_[kSentinel].next;
+      index_type *link = &nodes_[kSentinel].next;
+
+      while (rest != kSentinel) {
+        index_type left = rest;
+        index_type right = CutAfter(left, width);
+        rest = CutAfter(right, width);
+
+        // A throwing comp leaves the list complete but partly sorted.
+        try {
+          MergeRuns(left, right, link, comp);
+        } catch (...) {
+          AppendChains(link, {left, right, rest});
+          RelinkPrev();
+          throw;
+        }
+      }
+    }
+
+    RelinkPrev();
+  }
+
+ private:
+  reference Value(index_type index) const noexcept {
+    return *std::launder(
+        reinterpret_cast<value_type *>(nodes_[index].storage));
+  }
+
+  // Next slot after index; an unallocated slab reads as an empty ring.
+  index_type Link(index_type index) const noexcept {
+    return nodes_ ? nodes_[index].next : kSentinel;
+  }
+
+  // Takes a slot from the free list or the untouched tail of the slab,
+  // which must not be exhausted, constructs the element there and links
+  // it in front of pos.
+  template <typename... Args>
+  iterator Place(index_type pos, Args &&...args) {
+    index_type slot = free_ != kSentinel ? free_ : used_;
+    new (nodes_[slot].storage) value_type(std::forward<Args>(args)...);
+
+    if (slot == free_) {
+      free_ = nodes_[slot].next;
+    } else {
+      ++used_;
+    }
+
+    index_type before = nodes_[pos].prev;
+    nodes_[slot].prev = before;
+    nodes_[slot].next = pos;
+    nodes_[before].next = slot;
+    nodes_[pos].prev = slot;
+
+    ++size_;
+    return iterator(this, slot);
+  }
+
+  void EraseSlot(index_type slot) noexcept {
+    nodes_[nodes_[slot].prev].next = nodes_[slot].next;
+    nodes_[nodes_[slot].next].prev = nodes_[slot].prev;
+    Value(slot).~value_type();
+
+    nodes_[slot].next = free_;
+    free_ = slot;
+    --size_;
+  }
+
+  void Grow() {
+    if (capacity_ > max_size()) {
+      throw std::length_error("Out of container's limit");
+    }
+
+    size_type limit = max_size() + 1;
+    size_type slots = capacity_ < kMinSlots ? kMinSlots : 2 * capacity_;
+    Reallocate(slots < limit ? slots : limit);
+  }
+
+  // Moves the slab into a new allocation of slots nodes. Links and the free
+  // list are copied as they are; live elements are moved, or copied if
+  // their move may throw. The old slab is only touched once every element
+  // has been built, so a throwing copy leaves the list as it was.
+  void Reallocate(size_type slots) {
+    Node *nodes = node_traits::allocate(alloc_, slots);
+
+    if (nodes_ == nullptr) {
+      nodes[kSentinel].next = nodes[kSentinel].prev = kSentinel;
+      used_ = 1;
+    } else {
+      for (index_type i = 0; i < used_; ++i) {
+        nodes[i].next = nodes_[i].next;
+        nodes[i].prev = nodes_[i].prev;
+      }
+
+      index_type built = nodes_[kSentinel].next;
+
+      try {
+        for (; built != kSentinel; built = nodes_[built].next) {
+          new (nodes[built].storage)
+              value_type(std::move_if_noexcept(Value(built)));
+        }
+      } catch (...) {
+        for (index_type i = nodes_[kSentinel].next; i != built;
+             i = nodes_[i].next) {
+          std::launder(reinterpret_cast<value_type *>(nodes[i].storage))
+              ->~value_type();
+        }
+
+        node_traits::deallocate(alloc_, nodes, slots);
+        throw;
+      }
+
+      for (index_type i = nodes_[kSentinel].next; i != kSentinel;
+           i = nodes_[i].next) {
+        Value(i).~value_type();
+      }
+
+      node_traits::deallocate(alloc_, nodes_, capacity_);
+    }
+
+    nodes_ = nodes;
+    capacity_ = static_cast<index_type>(slots);
+  }
+
+  void FreeSlab() noexcept {
+    if (nodes_) {
+      node_traits::deallocate(alloc_, nodes_, capacity_);
+    }
+
+    nodes_ = nullptr;
+    capacity_ = used_ = 0;
+    free_ = kSentinel;
+    size_ = 0;
+  }
+
+  void SwapSlabs(arena_list &other) noexcept {
+    std::swap(nodes_, other.nodes_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(used_, other.used_);
+    std::swap(free_, other.free_);
+    std::swap(size_, other.size_);
+  }
+
+  // Detaches the slots following the first count slots of run and returns
+  // the first detached slot.
+  index_type CutAfter(index_type run, size_type count) noexcept {
+    for (size_type i = 1; run != kSentinel && i < count; ++i) {
+      run = nodes_[run].next;
+    }
+
+    if (run == kSentinel) {
+      return kSentinel;
+    }
+
+    index_type rest = nodes_[run].next;
+    nodes_[run].next = kSentinel;
+    return rest;
+  }
+
+  // Stably merges two runs into *link, following next indices only, and
+  // leaves link at the next field of the last merged slot. If comp throws,
+  // left and right hold the unmerged rest of each run and link the field
+  // they belong behind.
+  template <typename Compare>
+  void MergeRuns(index_type &left, index_type &right, index_type *&link,
+                 Compare &comp) {
+    while (left != kSentinel && right != kSentinel) {
+      if (comp(Value(right), Value(left))) {
+        *link = right;
+        right = nodes_[right].next;
+      } else {
+        *link = left;
+        left = nodes_[left].next;
+      }
+      link = &nodes_[*link].next;
+    }
+
+    AppendChains(link, {left, right});
+  }
+
+  // Links the runs one after another into *link and leaves link at the
+  // next field of the last slot.
+  void AppendChains(index_type *&link,
+                    std::initializer_list<index_type> chains) noexcept {
+    for (index_type chain : chains) {
+      *link = chain;
+      while (*link != kSentinel) {
+        link = &nodes_[*link].next;
+      }
+    }
+  }
+
+  // Rebuilds the prev indices from the next chain after it was relinked.
+  void RelinkPrev() noexcept {
+    index_type prev = kSentinel;
+    for (index_type i = nodes_[kSentinel].next; i != kSentinel;
+         i = nodes_[i].next) {
+      nodes_[i].prev = prev;
+      prev = i;
+    }
+    nodes_[kSentinel].prev = prev;
+  }
+
+  void CopyFrom(const arena_list &l) {
+    reserve(l.size_);
+    for (iterator it = l.begin(); it != l.end(); ++it) {
+      push_back(*it);
+    }
+  }
+
+  node_allocator_type alloc_;
+  Node *nodes_;
+  index_type capacity_;
+  index_type used_;
+  index_type free_;
+
+  size_type size_;
+};
+}  // namespace s21
+
+#endif  // S21_ARENA_LIST_H
@@ -0,0 +1,296 @@
+#ifndef S21_COW_VECTOR_H
+#define S21_COW_VECTOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+// Copy-on-write vector. Copies share one atomically reference-counted
+// buffer; the first mutation through a copy that is not the sole owner
+// clones the buffer. Const access never clones, so a large read-only vector
+// can be handed to many consumers by value at the cost of a counter
+// increment. Non-const accessors count as mutations, so prefer const
+// references (or cbegin/cend) on the read path. They, like insert(), also
+// hand out references a later copy must not see change, so the buffer they
+// point into stops being shareable: copies of it are deep until clear()
+// invalidates those references.
+template <typename T, typename Allocator = std::allocator<T>>
+class cow_vector {
+ public:
+  using vector_type = vector<T, Allocator>;
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using pointer = T *;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using iterator = T *;
+  using const_iterator = const T *;
+
+ private:
+  struct Shared {
+    explicit Shared(vector_type &&items) : items(std::move(items)) {}
+
+    std::atomic<size_type> refs{1};
+    // Written only by the sole owner, after mutable access was handed out.
+    bool shareable = true;
+    vector_type items;
+  };
+
+  using shared_allocator_type = typename std::allocator_traits<
+      allocator_type>::template rebind_alloc<Shared>;
+  using shared_traits = std::allocator_traits<shared_allocator_type>;
+
+ public:
+  cow_vector() noexcept(noexcept(allocator_type()))
+      : cow_vector(allocator_type()) {}
+
+  explicit cow_vector(const allocator_type &alloc) noexcept
+      : alloc_(alloc), shared_(nullptr) {}
+
+  explicit cow_vector(size_type n,
+                      const allocator_type &alloc = allocator_type())
+      : cow_vector(vector_type(n, alloc)) {}
+
+  cow_vector(std::initializer_list<value_type> const &items,
+             const allocator_type &alloc = allocator_type())
+      : cow_vector(vector_type(items, alloc)) {}
+
+  // Takes over the elements of items without copying them.
+  explicit cow_vector(vector_type &&items)
+      : alloc_(items.get_allocator()), shared_(nullptr) {
+    if (!items.empty()) {
+      shared_ = Create(std::move(items));
+    }
+  }
+
+  cow_vector(const cow_vector &v) : alloc_(v.alloc_), shared_(v.shared_) {
+    if (shared_ && !shared_->shareable) {
+      shared_ = Create(vector_type(v.shared_->items, alloc_));
+    } else {
+      Retain();
+    }
+  }
+
+  cow_vector(cow_vector &&v) noexcept
+      : alloc_(std::move(v.alloc_)), shared_(v.shared_) {
+    v.shared_ = nullptr;
+  }
+
+  ~cow_vector() noexcept { Release(); }
+
+  cow_vector &operator=(const cow_vector &v) {
+    if (shared_ != v.shared_) {
+      cow_vector copy(v);
+      swap(copy);
+    }
+
+    return *this;
+  }
+
+  cow_vector &operator=(cow_vector &&v) noexcept {
+    if (this != &v) {
+      Release();
+      alloc_ = std::move(v.alloc_);
+      shared_ = v.shared_;
+      v.shared_ = nullptr;
+    }
+
+    return *this;
+  }
+
+  allocator_type get_allocator() const noexcept { return alloc_; }
+
+  // Number of cow_vectors sharing the buffer; 0 when nothing is allocated.
+  size_type use_count() const noexcept {
+    return shared_ ? shared_->refs.load(std::memory_order_acquire) : 0;
+  }
+
+  // Read-only view of the elements, e.g. for the s21::simd kernels. The
+  // reference stays valid until this cow_vector is next mutated.
+  const vector_type &items() const noexcept {
+    static const vector_type empty;
+    return shared_ ? shared_->items : empty;
+  }
+
+  // Element access
+  const_reference at(size_type pos) const {
+    if (pos >= size()) {
+      throw std::out_of_range("Index out of bounds");
+    }
+
+    return data()[pos];
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size()) {
+      throw std::out_of_range("Index out of bounds");
+    }
+
+    return data()[pos];
+  }
+
+  const_reference operator[](size_type pos) const noexcept {
+    return data()[pos];
+  }
+
+  reference operator[](size_type pos) { return data()[pos]; }
+
+  const_reference front() const noexcept { return data()[0]; }
+
+  reference front() { return data()[0]; }
+
+  const_reference back() const noexcept { return data()[size() - 1]; }
+
+  reference back() { return data()[size() - 1]; }
+
+  const T *data() const noexcept {
+    return shared_ ? shared_->items.data() : nullptr;
+  }
+
+  pointer data() { return shared_ ? Unshareable().data() : nullptr; }
+
+  // Iterators
+  const_iterator begin() const noexcept { return data(); }
+
+  const_iterator end() const noexcept { return data() + size(); }
+
+  iterator begin() { return data(); }
+
+  iterator end() { return data() + size(); }
+
+  const_iterator cbegin() const noexcept { return begin(); }
+
+  const_iterator cend() const noexcept { return end(); }
+
+  // Capacity
+  bool empty() const noexcept { return size() == 0; }
+
+  size_type size() const noexcept {
+    return shared_ ? shared_->items.size() : 0;
+  }
+
+  size_type max_size() const noexcept { return items().max_size(); }
+
+  void reserve(size_type size) { Mutable().reserve(size); }
+
+  size_type capacity() const noexcept {
+    return shared_ ? shared_->items.capacity() : 0;
+  }
+
+  void shrink_to_fit() {
+    if (shared_) {
+      Mutable().shrink_to_fit();
+    }
+  }
+
+  // Modifiers
+  // A shared buffer is simply let go of rather than cloned and emptied.
+  void clear() noexcept {
+    if (shared_ && shared_->refs.load(std::memory_order_acquire) == 1) {
+      shared_->items.clear();
+      shared_->shareable = true;
+    } else {
+      Release();
+    }
+  }
+
+  iterator insert(const_iterator pos, const_reference value) {
+    size_type index = pos - cbegin();
+    if (index > size()) {
+      throw std::out_of_range("Index out of bounds");
+    }
+
+    vector_type &elements = Unshareable();
+    return elements.insert(elements.begin() + index, value).GetPtr();
+  }
+
+  void erase(const_iterator pos) {
+    size_type index = pos - cbegin();
+    if (index >= size()) {
+      throw std::out_of_range("Index out of bounds");
+    }
+
+    vector_type &elements = Mutable();
+    elements.erase(elements.begin() + index);
+  }
+
+  void push_back(const_reference value) { Mutable().push_back(value); }
+
+  void pop_back() {
+    if (!empty()) {
+      Mutable().pop_back();
+    }
+  }
+
+  void swap(cow_vector &other) noexcept {
+    std::swap(alloc_, other.alloc_);
+    std::swap(shared_, other.shared_);
+  }
+
+ private:
+  Shared *Create(vector_type &&items) {
+    shared_allocator_type shared_alloc(alloc_);
+    Shared *shared = shared_traits::allocate(shared_alloc, 1);
+
+    try {
+      shared_traits::construct(shared_alloc, shared, std::move(items));
+    } catch (...) {
+      shared_traits::deallocate(shared_alloc, shared, 1);
+      throw;
+    }
+
+    return shared;
+  }
+
+  void Retain() noexcept {
+    if (shared_) {
+      shared_->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  void Release() noexcept {
+    if (shared_ &&
+        shared_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      shared_allocator_type shared_alloc(alloc_);
+      shared_traits::destroy(shared_alloc, shared_);
+      shared_traits::deallocate(shared_alloc, shared_, 1);
+    }
+
+    shared_ = nullptr;
+  }
+
+  // Returns the elements for writing, cloning them first unless this is the
+  // only owner. The acquire load pairs with the release in other owners'
+  // Release(), so their reads of the old buffer happen before our writes.
+  vector_type &Mutable() {
+    if (shared_ == nullptr) {
+      shared_ = Create(vector_type(alloc_));
+    } else if (shared_->refs.load(std::memory_order_acquire) != 1) {
+      Shared *copy = Create(vector_type(shared_->items, alloc_));
+      Release();
+      shared_ = copy;
+    }
+
+    return shared_->items;
+  }
+
+  // Mutable for a caller that keeps references into the elements.
+  vector_type &Unshareable() {
+    vector_type &items = Mutable();
+    shared_->shareable = false;
+    return items;
+  }
+
+  allocator_type alloc_;
+  Shared *shared_;
+};
+}  // namespace s21
+
+#endif  // S21_COW_VECTOR_H
@@ -0,0 +1,597 @@
+#ifndef S21_DEQUE_H
+#define S21_DEQUE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+namespace detail {
+constexpr size_t FloorPowerOfTwo(size_t n) noexcept {
+  size_t power = 1;
+  while (power * 2 <= n) {
+    power *= 2;
+  }
+  return power;
+}
+}  // namespace detail
+
+// Double-ended sequence stored in fixed-size blocks reached through a map of
+// block pointers. Pushing or popping at either end never moves an element,
+// so references stay valid; only the map of pointers is ever reallocated.
+// Blocks are allocated on demand. Each end keeps the last block it emptied
+// as a spare for its next push, so a size oscillating around a block
+// boundary does not allocate and free a block every time.
+template <typename T, typename Allocator = std::allocator<T>>
+class deque {
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using pointer = T *;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+
+ private:
+  using alloc_traits = std::allocator_traits<allocator_type>;
+  using map_allocator_type =
+      typename alloc_traits::template rebind_alloc<pointer>;
+  using map_traits = std::allocator_traits<map_allocator_type>;
+
+  static_assert(std::is_same<typename alloc_traits::value_type, T>::value,
+                "Allocator::value_type must be T");
+  static_assert(std::is_same<typename alloc_traits::pointer, pointer>::value,
+                "Allocator must hand out raw pointers");
+
+  static constexpr size_type kBlockBytes = 4096;
+  static constexpr size_type kBlockSize = detail::FloorPowerOfTwo(
+      kBlockBytes / sizeof(T) > 16 ? kBlockBytes / sizeof(T) : 16);
+  static constexpr size_type kMinMapSize = 8;
+
+  static size_type BlockOf(size_type pos) noexcept { return pos / kBlockSize; }
+  static size_type OffsetOf(size_type pos) noexcept { return pos % kBlockSize; }
+
+  class DequeIterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+
+    DequeIterator() = default;
+    DequeIterator(pointer *map, size_type pos) : map_(map), pos_(pos) {}
+
+    reference operator*() const noexcept {
+      return map_[BlockOf(pos_)][OffsetOf(pos_)];
+    }
+    value_type *operator->() const noexcept { return &**this; }
+
+    bool operator!=(const DequeIterator &rhs) const noexcept {
+      return pos_ != rhs.pos_;
+    }
+    bool operator==(const DequeIterator &rhs) const noexcept {
+      return pos_ == rhs.pos_;
+    }
+
+    bool operator<(const DequeIterator &rhs) const noexcept {
+      return pos_ < rhs.pos_;
+    }
+    bool operator<=(const DequeIterator &rhs) const noexcept {
+      return pos_ <= rhs.pos_;
+    }
+    bool operator>(const DequeIterator &rhs) const noexcept {
+      return pos_ > rhs.pos_;
+    }
+    bool operator>=(const DequeIterator &rhs) const noexcept {
+      return pos_ >= rhs.pos_;
+    }
+
+    DequeIterator operator++(int) noexcept {
+      DequeIterator temp = *this;
+      ++pos_;
+      return temp;
+    }
+    DequeIterator &operator++() noexcept {
+      ++pos_;
+      return *this;
+    }
+    DequeIterator operator--(int) noexcept {
+      DequeIterator temp = *this;
+      --pos_;
+      return temp;
+    }
+    DequeIterator &operator--() noexcept {
+      --pos_;
+      return *this;
+    }
+
+    DequeIterator &operator+=(difference_type n) noexcept {
+      pos_ += n;
+      return *this;
+    }
+    DequeIterator &operator-=(difference_type n) noexcept {
+      pos_ -= n;
+      return *this;
+    }
+    DequeIterator operator+(difference_type n) const noexcept {
+      return DequeIterator(map_, pos_ + n);
+    }
+    DequeIterator operator-(difference_type n) const noexcept {
+      return DequeIterator(map_, pos_ - n);
+    }
+    difference_type operator-(const DequeIterator &rhs) const noexcept {
+      return static_cast<difference_type>(pos_ - rhs.pos_);
+    }
+    reference operator[](difference_type n) const noexcept {
+      return *(*this + n);
+    }
+
+    size_type GetPos() const noexcept { return pos_; }
+
+   private:
+    pointer *map_ = nullptr;
+    size_type pos_ = 0;
+  };
+
+ public:
+  using iterator = DequeIterator;
+  using const_iterator = const DequeIterator;
+
+  deque() noexcept(noexcept(allocator_type())) : deque(allocator_type()) {}
+
+  explicit deque(const allocator_type &alloc) noexcept
+      : alloc_(alloc),
+        map_(nullptr),
+        map_size_(0),
+        start_(0),
+        size_(0),
+        spare_front_(nullptr),
+        spare_back_(nullptr) {}
+
+  explicit deque(size_type n, const allocator_type &alloc = allocator_type())
+      : deque(alloc) {
+    try {
+      for (size_type i = 0; i < n; ++i) {
+        emplace_back();
+      }
+    } catch (...) {
+      Release();
+      throw;
+    }
+  }
+
+  deque(std::initializer_list<value_type> const &items,
+        const allocator_type &alloc = allocator_type())
+      : deque(alloc) {
+    try {
+      for (const auto &item : items) {
+        push_back(item);
+      }
+    } catch (...) {
+      Release();
+      throw;
+    }
+  }
+
+  deque(const deque &d)
+      : deque(alloc_traits::select_on_container_copy_construction(d.alloc_)) {
+    try {
+      CopyFrom(d);
+    } catch (...) {
+      Release();
+      throw;
+    }
+  }
+
+  deque(deque &&d) noexcept
+      : alloc_(std::move(d.alloc_)),
+        map_(d.map_),
+        map_size_(d.map_size_),
+        start_(d.start_),
+        size_(d.size_),
+        spare_front_(std::exchange(d.spare_front_, nullptr)),
+        spare_back_(std::exchange(d.spare_back_, nullptr)) {
+    d.map_ = nullptr;
+    d.map_size_ = d.start_ = d.size_ = 0;
+  }
+
+  ~deque() noexcept { Release(); }
+
+  deque &operator=(const deque &d) {
+    if (this != &d) {
+      if (alloc_traits::propagate_on_container_copy_assignment::value &&
+          alloc_ != d.alloc_) {
+        Release();
+      }
+
+      if (alloc_traits::propagate_on_container_copy_assignment::value) {
+        alloc_ = d.alloc_;
+      }
+
+      clear();
+      CopyFrom(d);
+    }
+
+    return *this;
+  }
+
+  deque &operator=(deque &&d) noexcept(
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value) {
+    if (this != &d) {
+      if (alloc_traits::propagate_on_container_move_assignment::value ||
+          alloc_ == d.alloc_) {
+        Release();
+
+        if (alloc_traits::propagate_on_container_move_assignment::value) {
+          alloc_ = std::move(d.alloc_);
+        }
+
+        map_ = d.map_;
+        map_size_ = d.map_size_;
+        start_ = d.start_;
+        size_ = d.size_;
+        spare_front_ = std::exchange(d.spare_front_, nullptr);
+        spare_back_ = std::exchange(d.spare_back_, nullptr);
+
+        d.map_ = nullptr;
+        d.map_size_ = d.start_ = d.size_ = 0;
+      } else {
+        clear();
+
+        for (size_type i = 0; i < d.size_; ++i) {
+          push_back(std::move(d[i]));
+        }
+
+        d.clear();
+      }
+    }
+
+    return *this;
+  }
+
+  allocator_type get_allocator() const noexcept { return alloc_; }
+
+  // Element access
+  reference at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("Index out of bounds");
+    }
+
+    return (*this)[pos];
+  }
+
+  reference operator[](size_type pos) const noexcept {
+    return Slot(start_ + pos);
+  }
+
+  const_reference front() const noexcept { return Slot(start_); }
+
+  const_reference back() const noexcept { return Slot(start_ + size_ - 1); }
+
+  // Iterators
+  iterator begin() const noexcept { return iterator(map_, start_); }
+
+  iterator end() const noexcept { return iterator(map_, start_ + size_); }
+
+  // Capacity
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept {
+    size_type limit =
+        std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+    size_type alloc_limit = alloc_traits::max_size(alloc_);
+
+    return alloc_limit < limit ? alloc_limit : limit;
+  }
+
+  // Trims the block map down to the blocks in use and drops it entirely,
+  // together with the spare blocks, once the deque is empty.
+  void shrink_to_fit() {
+    if (size_ == 0) {
+      Release();
+    } else {
+      RemapBlocks(std::max(kMinMapSize, UsedBlocks()));
+    }
+  }
+
+  // Modifiers
+  void clear() noexcept {
+    for (size_type i = 0; i < size_; ++i) {
+      alloc_traits::destroy(alloc_, &Slot(start_ + i));
+    }
+
+    for (size_type i = 0; i < map_size_; ++i) {
+      FreeBlock(i);
+    }
+
+    size_ = 0;
+    start_ = map_size_ / 2 * kBlockSize;
+  }
+
+  iterator insert(iterator pos, const_reference value) {
+    size_type index = pos.GetPos() - start_;
+
+    if (index > size_) {
+      throw std::out_of_range("Index out of bounds");
+    }
+
+    value_type copy(value);
+
+    if (index == 0) {
+      push_front(std::move(copy));
+    } else if (index == size_) {
+      push_back(std::move(copy));
+    } else if (index < size_ / 2) {
+      push_front(std::move((*this)[0]));
+
+      for (size_type i = 1; i < index; ++i) {
+        (*this)[i] = std::move((*this)[i + 1]);
+      }
+
+      (*this)[index] = std::move(copy);
+    } else {
+      push_back(std::move((*this)[size_ - 1]));
+
+      for (size_type i = size_ - 2; i > index; --i) {
+        (*this)[i] = std::move((*this)[i - 1]);
+      }
+
+      (*this)[index] = std::move(copy);
+    }
+
+    return iterator(map_, start_ + index);
+  }
+
+  // Shifts whichever side of pos is shorter, so at most size() / 2 elements
+  // move.
+  void erase(iterator pos) {
+    size_type index = pos.GetPos() - start_;
+
+    if (index >= size_) {
+      throw std::out_of_range("Index out of bounds");
+    }
+
+    if (index < size_ / 2) {
+      for (size_type i = index; i > 0; --i) {
+        (*this)[i] = std::move((*this)[i - 1]);
+      }
+
+      pop_front();
+    } else {
+      for (size_type i = index; i + 1 < size_; ++i) {
+        (*this)[i] = std::move((*this)[i + 1]);
+      }
+
+      pop_back();
+    }
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  void push_front(const_reference value) { emplace_front(value); }
+
+  void push_front(value_type &&value) { emplace_front(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (BlockOf(start_ + size_) >= map_size_) {
+      Rebalance();
+    }
+
+    pointer slot =
+        Construct(start_ + size_, spare_back_, std::forward<Args>(args)...);
+    ++size_;
+    return *slot;
+  }
+
+  template <typename... Args>
+  reference emplace_front(Args &&...args) {
+    if (start_ == 0) {
+      Rebalance();
+    }
+
+    pointer slot =
+        Construct(start_ - 1, spare_front_, std::forward<Args>(args)...);
+    --start_;
+    ++size_;
+    return *slot;
+  }
+
+  void pop_back() noexcept {
+    if (size_ > 0) {
+      size_type pos = start_ + size_ - 1;
+      alloc_traits::destroy(alloc_, &Slot(pos));
+      --size_;
+
+      if (OffsetOf(pos) == 0) {
+        ParkBlock(BlockOf(pos), spare_back_);
+      }
+    }
+  }
+
+  void pop_front() noexcept {
+    if (size_ > 0) {
+      alloc_traits::destroy(alloc_, &Slot(start_));
+      ++start_;
+      --size_;
+
+      if (OffsetOf(start_) == 0) {
+        ParkBlock(BlockOf(start_ - 1), spare_front_);
+      }
+    }
+  }
+
+  void swap(deque &other) noexcept {
+    if (alloc_traits::propagate_on_container_swap::value) {
+      std::swap(alloc_, other.alloc_);
+    }
+
+    std::swap(map_, other.map_);
+    std::swap(map_size_, other.map_size_);
+    std::swap(start_, other.start_);
+    std::swap(size_, other.size_);
+    std::swap(spare_front_, other.spare_front_);
+    std::swap(spare_back_, other.spare_back_);
+  }
+
+ private:
+  reference Slot(size_type pos) const noexcept {
+    return map_[BlockOf(pos)][OffsetOf(pos)];
+  }
+
+  // Constructs an element at absolute position pos, taking its block from
+  // spare or allocating it first if needed. A block set up here goes back
+  // to spare on failure.
+  template <typename... Args>
+  pointer Construct(size_type pos, pointer &spare, Args &&...args) {
+    pointer &block = map_[BlockOf(pos)];
+    bool fresh = block == nullptr;
+
+    if (fresh) {
+      block = spare ? std::exchange(spare, nullptr)
+                    : alloc_traits::allocate(alloc_, kBlockSize);
+    }
+
+    pointer slot = block + OffsetOf(pos);
+    try {
+      alloc_traits::construct(alloc_, slot, std::forward<Args>(args)...);
+    } catch (...) {
+      if (fresh) {
+        ParkBlock(BlockOf(pos), spare);
+      }
+      throw;
+    }
+
+    return slot;
+  }
+
+  // Keeps the emptied block as the spare of one end, or frees it if that
+  // end already has one.
+  void ParkBlock(size_type block, pointer &spare) noexcept {
+    if (spare == nullptr) {
+      spare = std::exchange(map_[block], nullptr);
+    } else {
+      FreeBlock(block);
+    }
+  }
+
+  void FreeBlock(size_type block) noexcept {
+    if (map_[block]) {
+      alloc_traits::deallocate(alloc_, map_[block], kBlockSize);
+      map_[block] = nullptr;
+    }
+  }
+
+  void FreeSpare(pointer &spare) noexcept {
+    if (spare) {
+      alloc_traits::deallocate(alloc_, std::exchange(spare, nullptr),
+                               kBlockSize);
+    }
+  }
+
+  // Blocks are only ever live between the front block and the block holding
+  // the past-the-end position, both clamped to the map.
+  size_type FirstBlock() const noexcept {
+    return std::min(BlockOf(start_), map_size_ - 1);
+  }
+
+  size_type UsedBlocks() const noexcept {
+    size_type last = std::min(BlockOf(start_ + size_), map_size_ - 1);
+    return last - FirstBlock() + 1;
+  }
+
+  // Makes room for one more block at either end: slides the live blocks to
+  // the middle of the map when it is at most half full, otherwise moves them
+  // into a map twice the size they need.
+  void Rebalance() {
+    size_type needed = (map_size_ == 0) ? 1 : UsedBlocks() + 1;
+
+    if (map_size_ >= kMinMapSize && needed * 2 <= map_size_) {
+      RemapBlocks(map_size_);
+    } else {
+      RemapBlocks(std::max(kMinMapSize, needed * 2));
+    }
+  }
+
+  // Centres the live blocks in a map of new_size entries, reallocating the
+  // map when its size changes. Elements themselves never move.
+  void RemapBlocks(size_type new_size) {
+    if (map_size_ == 0) {
+      map_allocator_type map_alloc(alloc_);
+      map_ = map_traits::allocate(map_alloc, new_size);
+      std::fill(map_, map_ + new_size, nullptr);
+      map_size_ = new_size;
+      start_ = new_size / 2 * kBlockSize;
+      return;
+    }
+
+    size_type first = FirstBlock();
+    size_type used = UsedBlocks();
+    size_type new_first = (new_size - used) / 2;
+    size_type front_block = BlockOf(start_) - first;
+    pointer *new_map = map_;
+
+    if (new_size != map_size_) {
+      map_allocator_type map_alloc(alloc_);
+      new_map = map_traits::allocate(map_alloc, new_size);
+    }
+
+    std::memmove(static_cast<void *>(new_map + new_first), map_ + first,
+                 used * sizeof(pointer));
+    std::fill(new_map, new_map + new_first, nullptr);
+    std::fill(new_map + new_first + used, new_map + new_size, nullptr);
+
+    if (new_map != map_) {
+      map_allocator_type map_alloc(alloc_);
+      map_traits::deallocate(map_alloc, map_, map_size_);
+      map_ = new_map;
+    }
+
+    map_size_ = new_size;
+    start_ = (new_first + front_block) * kBlockSize + OffsetOf(start_);
+  }
+
+  void CopyFrom(const deque &d) {
+    for (size_type i = 0; i < d.size_; ++i) {
+      push_back(d[i]);
+    }
+  }
+
+  void Release() noexcept {
+    clear();
+    FreeSpare(spare_front_);
+    FreeSpare(spare_back_);
+
+    if (map_) {
+      map_allocator_type map_alloc(alloc_);
+      map_traits::deallocate(map_alloc, map_, map_size_);
+      map_ = nullptr;
+    }
+
+    map_size_ = start_ = 0;
+  }
+
+  allocator_type alloc_;
+  pointer *map_;
+  size_type map_size_;
+  size_type start_;
+  size_type size_;
+  pointer spare_front_;
+  pointer spare_back_;
+};
+}  // namespace s21
+
+#endif  // S21_DEQUE_H
@@ -0,0 +1,765 @@
+#ifndef S21_DYNAMIC_BITSET_H
+#define S21_DYNAMIC_BITSET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_memory.h"
+#include "s21_vector.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define S21_BITSET_X86 1
+#endif
+
+namespace s21 {
+namespace detail {
+inline size_t PopcountGeneric(const uint64_t *words, size_t n) noexcept {
+  size_t count = 0;
+  for (size_t i = 0; i < n; ++i) {
+    count += __builtin_popcountll(words[i]);
+  }
+  return count;
+}
+
+#ifdef S21_BITSET_X86
+__attribute__((target("popcnt"))) inline size_t PopcountHardware(
+    const uint64_t *words, size_t n) noexcept {
+  size_t count = 0;
+  for (size_t i = 0; i < n; ++i) {
+    count += __builtin_popcountll(words[i]);
+  }
+  return count;
+}
+
+__attribute__((target("avx512f,avx512vpopcntdq"))) inline size_t
+PopcountAvx512(const uint64_t *words, size_t n) noexcept {
+  __m512i acc = _mm512_setzero_si512();
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    acc = _mm512_add_epi64(acc,
+                           _mm512_popcnt_epi64(_mm512_loadu_si512(words + i)));
+  }
+
+  size_t count = static_cast<size_t>(_mm512_reduce_add_epi64(acc));
+  for (; i < n; ++i) {
+    count += static_cast<size_t>(_mm_popcnt_u64(words[i]));
+  }
+  return count;
+}
+#endif
+
+// Number of set bits in words[0, n), using AVX-512 VPOPCNTDQ or the POPCNT
+// instruction when the CPU has them.
+inline size_t PopcountWords(const uint64_t *words, size_t n) noexcept {
+  using Kernel = size_t (*)(const uint64_t *, size_t) noexcept;
+  static const Kernel kernel = [] {
+#ifdef S21_BITSET_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512vpopcntdq")) {
+      return static_cast<Kernel>(PopcountAvx512);
+    }
+    if (__builtin_cpu_supports("popcnt")) {
+      return static_cast<Kernel>(PopcountHardware);
+    }
+#endif
+    return static_cast<Kernel>(PopcountGeneric);
+  }();
+  return kernel(words, n);
+}
+
+// Position of the k-th (0-based) set bit of word; word must have more than k
+// set bits.
+inline size_t SelectInWord(uint64_t word, size_t k) noexcept {
+  for (; k > 0; --k) {
+    word &= word - 1;
+  }
+  return static_cast<size_t>(__builtin_ctzll(word));
+}
+}  // namespace detail
+
+// Resizable bit set packed into 64-bit words. Bits past size() in the last
+// word are kept at zero so whole-word operations never see stale data.
+template <typename Allocator = std::allocator<uint64_t>,
+          typename GrowthPolicy = doubling_growth>
+class dynamic_bitset {
+ public:
+  using word_type = uint64_t;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  static constexpr size_type npos = static_cast<size_type>(-1);
+  static constexpr size_type kWordBits = 64;
+
+  dynamic_bitset() = default;
+
+  explicit dynamic_bitset(const allocator_type &alloc) : words_(alloc) {}
+
+  explicit dynamic_bitset(size_type bits, bool value = false,
+                          const allocator_type &alloc = allocator_type())
+      : words_(alloc) {
+    resize(bits, value);
+  }
+
+  dynamic_bitset(std::initializer_list<bool> const &items,
+                 const allocator_type &alloc = allocator_type())
+      : words_(alloc) {
+    reserve(items.size());
+    for (bool item : items) {
+      push_back(item);
+    }
+  }
+
+  allocator_type get_allocator() const noexcept {
+    return words_.get_allocator();
+  }
+
+  // Element access
+  bool operator[](size_type pos) const noexcept {
+    return (words_[pos / kWordBits] >> (pos % kWordBits)) & 1;
+  }
+
+  bool test(size_type pos) const {
+    CheckIndex(pos);
+    return (*this)[pos];
+  }
+
+  word_type *data() noexcept { return words_.data(); }
+
+  const word_type *data() const noexcept { return words_.data(); }
+
+  size_type num_words() const noexcept { return words_.size(); }
+
+  // Capacity
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept {
+    size_type words = words_.max_size();
+    return words > npos / kWordBits ? npos : words * kWordBits;
+  }
+
+  size_type capacity() const noexcept {
+    return words_.capacity() * kWordBits;
+  }
+
+  void reserve(size_type bits) { words_.reserve(WordsFor(bits)); }
+
+  void shrink_to_fit() { words_.shrink_to_fit(); }
+
+  // Modifiers
+  dynamic_bitset &set(size_type pos, bool value = true) {
+    CheckIndex(pos);
+    word_type mask = word_type(1) << (pos % kWordBits);
+    if (value) {
+      words_[pos / kWordBits] |= mask;
+    } else {
+      words_[pos / kWordBits] &= ~mask;
+    }
+    return *this;
+  }
+
+  dynamic_bitset &reset(size_type pos) { return set(pos, false); }
+
+  dynamic_bitset &flip(size_type pos) {
+    CheckIndex(pos);
+    words_[pos / kWordBits] ^= word_type(1) << (pos % kWordBits);
+    return *this;
+  }
+
+  dynamic_bitset &set() noexcept {
+    for (size_type i = 0; i < words_.size(); ++i) {
+      words_[i] = ~word_type(0);
+    }
+    ClearTail();
+    return *this;
+  }
+
+  dynamic_bitset &reset() noexcept {
+    for (size_type i = 0; i < words_.size(); ++i) {
+      words_[i] = 0;
+    }
+    return *this;
+  }
+
+  dynamic_bitset &flip() noexcept {
+    for (size_type i = 0; i < words_.size(); ++i) {
+      words_[i] = ~words_[i];
+    }
+    ClearTail();
+    return *this;
+  }
+
+  void push_back(bool value) {
+    if (size_ % kWordBits == 0) {
+      words_.push_back(0);
+    }
+    if (value) {
+      words_[size_ / kWordBits] |= word_type(1) << (size_ % kWordBits);
+    }
+    ++size_;
+  }
+
+  void pop_back() noexcept {
+    if (size_ > 0) {
+      --size_;
+      if (size_ % kWordBits == 0) {
+        words_.pop_back();
+      } else {
+        ClearTail();
+      }
+    }
+  }
+
+  void resize(size_type bits, bool value = false) {
+    size_type old_size = size_;
+    size_type words = WordsFor(bits);
+
+    words_.reserve(words);
+    while (words_.size() < words) {
+      words_.push_back(0);
+    }
+    while (words_.size() > words) {
+      words_.pop_back();
+    }
+
+    size_ = bits;
+    if (bits > old_size && value) {
+      SetRange(old_size, bits);
+    }
+    ClearTail();
+  }
+
+  void clear() noexcept {
+    words_.clear();
+    size_ = 0;
+  }
+
+  // Inserts value before pos, shifting the bits behind it by one.
+  void insert(size_type pos, bool value) {
+    if (pos > size_) {
+      throw std::out_of_range("Index out of bounds");
+    }
+
+    push_back(false);
+
+    size_type first = pos / kWordBits;
+    for (size_type w = words_.size() - 1; w > first; --w) {
+      words_[w] = (words_[w] << 1) | (words_[w - 1] >> (kWordBits - 1));
+    }
+
+    word_type low = LowMask(pos % kWordBits);
+    words_[first] = (words_[first] & low) | ((words_[first] << 1) & ~low);
+    ClearTail();
+    set(pos, value);
+  }
+
+  // Removes the bit at pos, shifting the bits behind it down by one.
+  void erase(size_type pos) {
+    CheckIndex(pos);
+
+    size_type first = pos / kWordBits;
+    size_type last = words_.size() - 1;
+    word_type low = LowMask(pos % kWordBits);
+    word_type carry =
+        first < last ? words_[first + 1] << (kWordBits - 1) : word_type(0);
+    words_[first] =
+        (words_[first] & low) | ((words_[first] >> 1) & ~low) | carry;
+
+    for (size_type w = first + 1; w <= last; ++w) {
+      carry = w < last ? words_[w + 1] << (kWordBits - 1) : word_type(0);
+      words_[w] = (words_[w] >> 1) | carry;
+    }
+
+    pop_back();
+  }
+
+  // Removes the bits of [first, last), moving the bits behind them down a
+  // whole word at a time.
+  void erase(size_type first, size_type last) {
+    if (first > last || last > size_) {
+      throw std::out_of_range("Index out of bounds");
+    }
+
+    if (first == last) {
+      return;
+    }
+
+    size_type shift = last - first;
+    size_type w = first / kWordBits;
+    size_type offset = first % kWordBits;
+    words_[w] = (words_[w] & LowMask(offset)) | (WordAt(last) << offset);
+
+    for (++w; w < WordsFor(size_ - shift); ++w) {
+      words_[w] = WordAt(w * kWordBits + shift);
+    }
+
+    resize(size_ - shift);
+  }
+
+  void swap(dynamic_bitset &other) noexcept {
+    words_.swap(other.words_);
+    std::swap(size_, other.size_);
+  }
+
+  // Bitwise operations; both operands must have the same size.
+  dynamic_bitset &operator&=(const dynamic_bitset &other) {
+    CheckSameSize(other);
+    for (size_type i = 0; i < words_.size(); ++i) {
+      words_[i] &= other.words_[i];
+    }
+    return *this;
+  }
+
+  dynamic_bitset &operator|=(const dynamic_bitset &other) {
+    CheckSameSize(other);
+    for (size_type i = 0; i < words_.size(); ++i) {
+      words_[i] |= other.words_[i];
+    }
+    return *this;
+  }
+
+  dynamic_bitset &operator^=(const dynamic_bitset &other) {
+    CheckSameSize(other);
+    for (size_type i = 0; i < words_.size(); ++i) {
+      words_[i] ^= other.words_[i];
+    }
+    return *this;
+  }
+
+  dynamic_bitset operator~() const {
+    dynamic_bitset result(*this);
+    result.flip();
+    return result;
+  }
+
+  bool operator==(const dynamic_bitset &other) const noexcept {
+    if (size_ != other.size_) {
+      return false;
+    }
+    for (size_type i = 0; i < words_.size(); ++i) {
+      if (words_[i] != other.words_[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool operator!=(const dynamic_bitset &other) const noexcept {
+    return !(*this == other);
+  }
+
+  // Queries
+  size_type count() const noexcept {
+    return detail::PopcountWords(words_.data(), words_.size());
+  }
+
+  bool any() const noexcept {
+    for (size_type i = 0; i < words_.size(); ++i) {
+      if (words_[i] != 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool none() const noexcept { return !any(); }
+
+  bool all() const noexcept { return count() == size_; }
+
+  size_type find_first() const noexcept { return FindFrom(0); }
+
+  // First set bit after pos, or npos.
+  size_type find_next(size_type pos) const noexcept {
+    return pos + 1 >= size_ ? npos : FindFrom(pos + 1);
+  }
+
+  // Number of set bits in [0, pos).
+  size_type rank(size_type pos) const noexcept {
+    if (pos > size_) {
+      pos = size_;
+    }
+
+    size_type full = pos / kWordBits;
+    size_type result = detail::PopcountWords(words_.data(), full);
+    if (pos % kWordBits != 0) {
+      result += static_cast<size_type>(
+          __builtin_popcountll(words_[full] & LowMask(pos % kWordBits)));
+    }
+    return result;
+  }
+
+  // Position of the k-th (0-based) set bit, or npos if there are not enough.
+  size_type select(size_type k) const noexcept {
+    for (size_type i = 0; i < words_.size(); ++i) {
+      size_type in_word =
+          static_cast<size_type>(__builtin_popcountll(words_[i]));
+      if (k < in_word) {
+        return i * kWordBits + detail::SelectInWord(words_[i], k);
+      }
+      k -= in_word;
+    }
+    return npos;
+  }
+
+ private:
+  static size_type WordsFor(size_type bits) noexcept {
+    return (bits + kWordBits - 1) / kWordBits;
+  }
+
+  static word_type LowMask(size_type bits) noexcept {
+    return bits == 0 ? 0 : ~word_type(0) >> (kWordBits - bits);
+  }
+
+  void CheckIndex(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("Index out of bounds");
+    }
+  }
+
+  void CheckSameSize(const dynamic_bitset &other) const {
+    if (size_ != other.size_) {
+      throw std::invalid_argument("Bitsets differ in size");
+    }
+  }
+
+  // The 64 bits starting at pos; bits past the end read as zero.
+  word_type WordAt(size_type pos) const noexcept {
+    size_type w = pos / kWordBits;
+    size_type offset = pos % kWordBits;
+
+    if (w >= words_.size()) {
+      return 0;
+    }
+
+    word_type word = words_[w] >> offset;
+    if (offset != 0 && w + 1 < words_.size()) {
+      word |= words_[w + 1] << (kWordBits - offset);
+    }
+    return word;
+  }
+
+  void ClearTail() noexcept {
+    if (size_ % kWordBits != 0) {
+      words_[words_.size() - 1] &= LowMask(size_ % kWordBits);
+    }
+  }
+
+  void SetRange(size_type first, size_type last) noexcept {
+    for (; first < last && first % kWordBits != 0; ++first) {
+      words_[first / kWordBits] |= word_type(1) << (first % kWordBits);
+    }
+    for (; first + kWordBits <= last; first += kWordBits) {
+      words_[first / kWordBits] = ~word_type(0);
+    }
+    for (; first < last; ++first) {
+      words_[first / kWordBits] |= word_type(1) << (first % kWordBits);
+    }
+  }
+
+  size_type FindFrom(size_type pos) const noexcept {
+    if (pos >= size_) {
+      return npos;
+    }
+
+    size_type w = pos / kWordBits;
+    word_type word = words_[w] & ~LowMask(pos % kWordBits);
+    while (word == 0) {
+      if (++w == words_.size()) {
+        return npos;
+      }
+      word = words_[w];
+    }
+    return w * kWordBits + static_cast<size_type>(__builtin_ctzll(word));
+  }
+
+  vector<word_type, allocator_type, GrowthPolicy> words_;
+  size_type size_ = 0;
+};
+
+template <typename A, typename G>
+dynamic_bitset<A, G> operator&(const dynamic_bitset<A, G> &lhs,
+                               const dynamic_bitset<A, G> &rhs) {
+  dynamic_bitset<A, G> result(lhs);
+  result &= rhs;
+  return result;
+}
+
+template <typename A, typename G>
+dynamic_bitset<A, G> operator|(const dynamic_bitset<A, G> &lhs,
+                               const dynamic_bitset<A, G> &rhs) {
+  dynamic_bitset<A, G> result(lhs);
+  result |= rhs;
+  return result;
+}
+
+template <typename A, typename G>
+dynamic_bitset<A, G> operator^(const dynamic_bitset<A, G> &lhs,
+                               const dynamic_bitset<A, G> &rhs) {
+  dynamic_bitset<A, G> result(lhs);
+  result ^= rhs;
+  return result;
+}
+
+// Bit-packed vector<bool>: one bit per element, stored in a dynamic_bitset
+// whose words come from Allocator rebound to uint64_t. Element access goes
+// through the proxy vector<bool>::reference.
+template <typename Allocator, typename GrowthPolicy>
+class vector<bool, Allocator, GrowthPolicy> {
+ public:
+  using value_type = bool;
+  using allocator_type = Allocator;
+  using growth_policy = GrowthPolicy;
+  using const_reference = bool;
+  using size_type = size_t;
+  using bitset_type = dynamic_bitset<
+      typename std::allocator_traits<Allocator>::template rebind_alloc<
+          uint64_t>,
+      GrowthPolicy>;
+
+ private:
+  using word_type = typename bitset_type::word_type;
+  static constexpr size_type kWordBits = bitset_type::kWordBits;
+
+ public:
+  class reference {
+   public:
+    reference(word_type *word, word_type mask) noexcept
+        : word_(word), mask_(mask) {}
+
+    operator bool() const noexcept { return (*word_ & mask_) != 0; }
+
+    reference &operator=(bool value) noexcept {
+      if (value) {
+        *word_ |= mask_;
+      } else {
+        *word_ &= ~mask_;
+      }
+      return *this;
+    }
+
+    reference &operator=(const reference &other) noexcept {
+      return *this = static_cast<bool>(other);
+    }
+
+    void flip() noexcept { *word_ ^= mask_; }
+
+   private:
+    word_type *word_;
+    word_type mask_;
+  };
+
+ private:
+  class BoolVectorIterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = bool;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = typename vector::reference;
+
+    BoolVectorIterator() = default;
+    BoolVectorIterator(word_type *words, size_type pos)
+        : words_(words), pos_(pos) {}
+
+    reference operator*() const noexcept {
+      return reference(words_ + pos_ / kWordBits,
+                       word_type(1) << (pos_ % kWordBits));
+    }
+    reference operator[](difference_type n) const noexcept {
+      return *(*this + n);
+    }
+
+    bool operator!=(const BoolVectorIterator &rhs) const noexcept {
+      return pos_ != rhs.pos_;
+    }
+    bool operator==(const BoolVectorIterator &rhs) const noexcept {
+      return pos_ == rhs.pos_;
+    }
+
+    bool operator<(const BoolVectorIterator &rhs) const noexcept {
+      return pos_ < rhs.pos_;
+    }
+    bool operator<=(const BoolVectorIterator &rhs) const noexcept {
+      return pos_ <= rhs.pos_;
+    }
+    bool operator>(const BoolVectorIterator &rhs) const noexcept {
+      return pos_ > rhs.pos_;
+    }
+    bool operator>=(const BoolVectorIterator &rhs) const noexcept {
+      return pos_ >= rhs.pos_;
+    }
+
+    BoolVectorIterator operator++(int) noexcept {
+      BoolVectorIterator temp = *this;
+      ++pos_;
+      return temp;
+    }
+    BoolVectorIterator &operator++() noexcept {
+      ++pos_;
+      return *this;
+    }
+    BoolVectorIterator operator--(int) noexcept {
+      BoolVectorIterator temp = *this;
+      --pos_;
+      return temp;
+    }
+    BoolVectorIterator &operator--() noexcept {
+      --pos_;
+      return *this;
+    }
+
+    BoolVectorIterator &operator+=(difference_type n) noexcept {
+      pos_ += n;
+      return *this;
+    }
+    BoolVectorIterator &operator-=(difference_type n) noexcept {
+      pos_ -= n;
+      return *this;
+    }
+    BoolVectorIterator operator+(difference_type n) const noexcept {
+      return BoolVectorIterator(words_, pos_ + n);
+    }
+    BoolVectorIterator operator-(difference_type n) const noexcept {
+      return BoolVectorIterator(words_, pos_ - n);
+    }
+    difference_type operator-(const BoolVectorIterator &rhs) const noexcept {
+      return static_cast<difference_type>(pos_) -
+             static_cast<difference_type>(rhs.pos_);
+    }
+
+    size_type GetIndex() const noexcept { return pos_; }
+
+   private:
+    word_type *words_ = nullptr;
+    size_type pos_ = 0;
+  };
+
+ public:
+  using iterator = BoolVectorIterator;
+  using const_iterator = const BoolVectorIterator;
+
+  vector() = default;
+
+  explicit vector(const allocator_type &alloc) : bits_(WordAllocator(alloc)) {}
+
+  explicit vector(size_type n, const allocator_type &alloc = allocator_type())
+      : bits_(n, false, WordAllocator(alloc)) {}
+
+  vector(std::initializer_list<bool> const &items,
+         const allocator_type &alloc = allocator_type())
+      : bits_(items, WordAllocator(alloc)) {}
+
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(bits_.get_allocator());
+  }
+
+  // Element access
+  reference at(size_type pos) const {
+    if (pos >= size()) {
+      throw std::out_of_range("Index out of bounds");
+    }
+
+    return (*this)[pos];
+  }
+
+  reference operator[](size_type pos) const noexcept {
+    return reference(Words() + pos / kWordBits,
+                     word_type(1) << (pos % kWordBits));
+  }
+
+  const_reference front() const noexcept { return bits_[0]; }
+
+  const_reference back() const noexcept { return bits_[size() - 1]; }
+
+  // Underlying words, for set operations, popcount and rank/select.
+  const bitset_type &bits() const noexcept { return bits_; }
+
+  // Iterators
+  iterator begin() const noexcept { return iterator(Words(), 0); }
+
+  iterator end() const noexcept { return iterator(Words(), size()); }
+
+  // Capacity
+  bool empty() const noexcept { return bits_.empty(); }
+
+  size_type size() const noexcept { return bits_.size(); }
+
+  size_type max_size() const noexcept { return bits_.max_size(); }
+
+  void reserve(size_type size) { bits_.reserve(size); }
+
+  size_type capacity() const noexcept { return bits_.capacity(); }
+
+  void shrink_to_fit() { bits_.shrink_to_fit(); }
+
+  // Modifiers
+  void clear() noexcept { bits_.clear(); }
+
+  iterator insert(iterator pos, const_reference value) {
+    size_type index = pos.GetIndex();
+    bits_.insert(index, value);
+    return iterator(Words(), index);
+  }
+
+  void erase(iterator pos) { bits_.erase(pos.GetIndex()); }
+
+  iterator erase(iterator first, iterator last) {
+    size_type index = first.GetIndex();
+    bits_.erase(index, last.GetIndex());
+    return iterator(Words(), index);
+  }
+
+  // Removes every element matching pred. All survivors hold the same value,
+  // so pred is asked once per value rather than once per element and the
+  // result is rebuilt from the popcount. Returns the number removed.
+  template <typename Predicate>
+  size_type remove_if(Predicate pred) {
+    size_type old_size = size();
+    size_type ones = bits_.count();
+    bool drop_false = pred(false);
+    bool drop_true = pred(true);
+
+    if (drop_true) {
+      bits_.reset();
+      bits_.resize(drop_false ? 0 : old_size - ones);
+    } else if (drop_false) {
+      bits_.resize(ones);
+      bits_.set();
+    }
+
+    return old_size - size();
+  }
+
+  void push_back(const_reference value) { bits_.push_back(value); }
+
+  void pop_back() noexcept { bits_.pop_back(); }
+
+  void swap(vector &other) noexcept { bits_.swap(other.bits_); }
+
+  void flip() noexcept { bits_.flip(); }
+
+ private:
+  using word_allocator_type = typename bitset_type::allocator_type;
+
+  static word_allocator_type WordAllocator(const allocator_type &alloc) {
+    return word_allocator_type(alloc);
+  }
+
+  word_type *Words() const noexcept {
+    return const_cast<word_type *>(bits_.data());
+  }
+
+  bitset_type bits_;
+};
+}  // namespace s21
+
+#undef S21_BITSET_X86
+
+#endif  // S21_DYNAMIC_BITSET_H
@@ -0,0 +1,216 @@
+#ifndef S21_EPOCH_H
+#define S21_EPOCH_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+// Epoch-based memory reclamation for lock-free structures. A thread pins
+// the domain while it reads shared nodes; a node unlinked while pinned is
+// handed to retire() and freed only once every thread that could still
+// see it has unpinned. The global epoch advances when all pinned threads
+// have observed it, and memory retired in epoch e is freed from epoch e+2
+// on. Each pin occupies one slot of the domain; slots and their bags of
+// retired memory are reused by later pins, and everything left is freed
+// when the domain is destroyed, which must not happen while pinned.
+class epoch_domain {
+  static constexpr uint64_t kIdle = std::numeric_limits<uint64_t>::max();
+  static constexpr size_t kBlockSlots = 64;
+  static constexpr size_t kBags = 3;
+  static constexpr size_t kAdvanceThreshold = 64;
+
+  struct Retired {
+    void *pointer;
+    void (*deleter)(void *);
+  };
+
+  // One pin at a time owns a slot; the bags are only touched by the owner.
+  struct alignas(64) Slot {
+    std::atomic<uint64_t> epoch{kIdle};
+    std::atomic<bool> taken{false};
+    uint64_t bag_epochs[kBags] = {};
+    std::vector<Retired> bags[kBags];
+  };
+
+  struct SlotBlock {
+    Slot slots[kBlockSlots];
+    std::atomic<SlotBlock *> next{nullptr};
+  };
+
+ public:
+  // Keeps the domain pinned for its lifetime. Pointers read from the
+  // protected structure stay valid until the guard is destroyed.
+  class guard {
+   public:
+    guard(const guard &) = delete;
+    guard &operator=(const guard &) = delete;
+
+    guard(guard &&g) noexcept
+        : domain_(g.domain_), slot_(std::exchange(g.slot_, nullptr)) {}
+
+    ~guard() noexcept {
+      if (slot_) {
+        slot_->epoch.store(kIdle, std::memory_order_release);
+        slot_->taken.store(false, std::memory_order_release);
+      }
+    }
+
+    // Frees pointer with deleter once no thread can reach it any more. The
+    // caller must have unlinked it from the shared structure.
+    void retire(void *pointer, void (*deleter)(void *)) {
+      domain_->Retire(*slot_, Retired{pointer, deleter});
+    }
+
+   private:
+    friend class epoch_domain;
+
+    guard(epoch_domain *domain, Slot *slot) noexcept
+        : domain_(domain), slot_(slot) {}
+
+    epoch_domain *domain_;
+    Slot *slot_;
+  };
+
+  epoch_domain() = default;
+
+  epoch_domain(const epoch_domain &) = delete;
+  epoch_domain &operator=(const epoch_domain &) = delete;
+
+  ~epoch_domain() noexcept {
+    FreeBlock(first_);
+
+    for (SlotBlock *block = first_.next.load(std::memory_order_acquire);
+         block;) {
+      SlotBlock *next = block->next.load(std::memory_order_acquire);
+      FreeBlock(*block);
+      delete block;
+      block = next;
+    }
+  }
+
+  guard pin() {
+    Slot &slot = Acquire();
+    uint64_t epoch = epoch_.load(std::memory_order_acquire);
+
+    // The slot must be visibly pinned before any shared node is read.
+    slot.epoch.store(epoch, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    Collect(slot, epoch);
+    return guard(this, &slot);
+  }
+
+  uint64_t epoch() const noexcept {
+    return epoch_.load(std::memory_order_acquire);
+  }
+
+ private:
+  // Takes a free slot, probing from a per-thread hint so that threads tend
+  // to keep their own slot, and appends a block of slots when all are in
+  // use.
+  Slot &Acquire() {
+    static thread_local size_t hint =
+        std::hash<std::thread::id>()(std::this_thread::get_id());
+
+    SlotBlock *block = &first_;
+    for (;;) {
+      for (size_t i = 0; i < kBlockSlots; ++i) {
+        size_t index = (hint + i) % kBlockSlots;
+        Slot &slot = block->slots[index];
+
+        if (!slot.taken.load(std::memory_order_relaxed) &&
+            !slot.taken.exchange(true, std::memory_order_acquire)) {
+          hint = index;
+          return slot;
+        }
+      }
+
+      SlotBlock *next = block->next.load(std::memory_order_acquire);
+      if (next == nullptr) {
+        SlotBlock *fresh = new SlotBlock;
+        if (block->next.compare_exchange_strong(next, fresh,
+                                                std::memory_order_acq_rel)) {
+          next = fresh;
+        } else {
+          delete fresh;
+        }
+      }
+
+      block = next;
+    }
+  }
+
+  // Bags are tagged with the global epoch read after the unlink, not the
+  // one the slot pinned: the latter may be stale, and a reader pinned
+  // later could still hold the pointer when the stale tag expires.
+  void Retire(Slot &slot, Retired retired) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+    size_t bag = epoch % kBags;
+
+    // A bag still holding an older epoch has been safe for two epochs.
+    if (slot.bag_epochs[bag] != epoch) {
+      Free(slot.bags[bag]);
+      slot.bag_epochs[bag] = epoch;
+    }
+
+    slot.bags[bag].push_back(retired);
+
+    if (slot.bags[bag].size() % kAdvanceThreshold == 0) {
+      TryAdvance(epoch);
+    }
+  }
+
+  // Frees every bag retired at least two epochs before epoch.
+  void Collect(Slot &slot, uint64_t epoch) noexcept {
+    for (size_t bag = 0; bag < kBags; ++bag) {
+      if (slot.bag_epochs[bag] + 2 <= epoch) {
+        Free(slot.bags[bag]);
+      }
+    }
+  }
+
+  // Moves the global epoch on if every pinned slot has observed it.
+  void TryAdvance(uint64_t epoch) noexcept {
+    for (SlotBlock *block = &first_; block;
+         block = block->next.load(std::memory_order_acquire)) {
+      for (Slot &slot : block->slots) {
+        uint64_t pinned = slot.epoch.load(std::memory_order_seq_cst);
+        if (pinned != kIdle && pinned != epoch) {
+          return;
+        }
+      }
+    }
+
+    epoch_.compare_exchange_strong(epoch, epoch + 1,
+                                   std::memory_order_seq_cst);
+  }
+
+  static void Free(std::vector<Retired> &bag) noexcept {
+    for (const Retired &retired : bag) {
+      retired.deleter(retired.pointer);
+    }
+
+    bag.clear();
+  }
+
+  static void FreeBlock(SlotBlock &block) noexcept {
+    for (Slot &slot : block.slots) {
+      for (std::vector<Retired> &bag : slot.bags) {
+        Free(bag);
+      }
+    }
+  }
+
+  std::atomic<uint64_t> epoch_{0};
+  SlotBlock first_;
+};
+}  // namespace s21
+
+#endif  // S21_EPOCH_H
@@ -0,0 +1,571 @@
+#ifndef S21_INCREMENTAL_VECTOR_H
+#define S21_INCREMENTAL_VECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_memory.h"
+
+namespace s21 {
+// vector with bounded-latency growth. When the buffer is full a larger one is
+// allocated, but the existing elements stay where they are: new elements go
+// straight into the new buffer and every following modifying operation moves
+// at most kMigrationStep old elements across. Until the migration finishes,
+// indexing checks which buffer an element lives in. No single push_back pays
+// for copying the whole buffer; operations that need contiguous storage
+// (data(), insert, erase, reserve) finish the migration first.
+template <typename T, typename Allocator = std::allocator<T>,
+          typename GrowthPolicy = doubling_growth>
+class incremental_vector {
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using growth_policy = GrowthPolicy;
+  using reference = T &;
+  using pointer = T *;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+
+  // Elements moved per operation while a migration is in progress: about a
+  // page worth, and at least two so that a migration started by doubling or
+  // 1.5x growth is over before the new buffer fills up.
+  static constexpr size_type kMigrationStep =
+      sizeof(T) >= 2048 ? 2 : 4096 / sizeof(T);
+
+ private:
+  using alloc_traits = std::allocator_traits<allocator_type>;
+
+  static_assert(std::is_same<typename alloc_traits::value_type, T>::value,
+                "Allocator::value_type must be T");
+  static_assert(std::is_same<typename alloc_traits::pointer, pointer>::value,
+                "Allocator must hand out raw pointers");
+
+  class IncrementalIterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+
+    IncrementalIterator() = default;
+    IncrementalIterator(const incremental_vector *owner, size_type index)
+        : owner_(owner), index_(index) {}
+
+    reference operator*() const noexcept { return (*owner_)[index_]; }
+    value_type *operator->() const noexcept { return &(*owner_)[index_]; }
+
+    bool operator!=(const IncrementalIterator &rhs) const noexcept {
+      return index_ != rhs.index_;
+    }
+    bool operator==(const IncrementalIterator &rhs) const noexcept {
+      return index_ == rhs.index_;
+    }
+
+    bool operator<(const IncrementalIterator &rhs) const noexcept {
+      return index_ < rhs.index_;
+    }
+    bool operator<=(const IncrementalIterator &rhs) const noexcept {
+      return index_ <= rhs.index_;
+    }
+    bool operator>(const IncrementalIterator &rhs) const noexcept {
+      return index_ > rhs.index_;
+    }
+    bool operator>=(const IncrementalIterator &rhs) const noexcept {
+      return index_ >= rhs.index_;
+    }
+
+    IncrementalIterator operator++(int) noexcept {
+      IncrementalIterator temp = *this;
+      ++index_;
+      return temp;
+    }
+    IncrementalIterator &operator++() noexcept {
+      ++index_;
+      return *this;
+    }
+    IncrementalIterator operator--(int) noexcept {
+      IncrementalIterator temp = *this;
+      --index_;
+      return temp;
+    }
+    IncrementalIterator &operator--() noexcept {
+      --index_;
+      return *this;
+    }
+
+    IncrementalIterator &operator+=(difference_type n) noexcept {
+      index_ += n;
+      return *this;
+    }
+    IncrementalIterator &operator-=(difference_type n) noexcept {
+      index_ -= n;
+      return *this;
+    }
+    IncrementalIterator operator+(difference_type n) const noexcept {
+      return IncrementalIterator(owner_, index_ + n);
+    }
+    IncrementalIterator operator-(difference_type n) const noexcept {
+      return IncrementalIterator(owner_, index_ - n);
+    }
+    difference_type operator-(const IncrementalIterator &rhs) const noexcept {
+      return static_cast<difference_type>(index_ - rhs.index_);
+    }
+    reference operator[](difference_type n) const noexcept {
+      return (*owner_)[index_ + n];
+    }
+
+    size_type GetIndex() const noexcept { return index_; }
+
+   private:
+    const incremental_vector *owner_ = nullptr;
+    size_type index_ = 0;
+  };
+
+ public:
+  using iterator = IncrementalIterator;
+  using const_iterator = const IncrementalIterator;
+
+  incremental_vector() noexcept(noexcept(allocator_type()))
+      : incremental_vector(allocator_type()) {}
+
+  explicit incremental_vector(const allocator_type &alloc) noexcept
+      : alloc_(alloc),
+        data_(nullptr),
+        size_(0),
+        capacity_(0),
+        old_(nullptr),
+        old_capacity_(0),
+        migrated_(0),
+        old_size_(0) {}
+
+  explicit incremental_vector(size_type n,
+                              const allocator_type &alloc = allocator_type())
+      : incremental_vector(alloc) {
+    try {
+      reserve(n);
+      for (; size_ < n; ++size_) {
+        alloc_traits::construct(alloc_, data_ + size_);
+      }
+    } catch (...) {
+      Deallocate();
+      throw;
+    }
+  }
+
+  incremental_vector(std::initializer_list<value_type> const &items,
+                     const allocator_type &alloc = allocator_type())
+      : incremental_vector(alloc) {
+    try {
+      reserve(items.size());
+      for (const auto &item : items) {
+        alloc_traits::construct(alloc_, data_ + size_, item);
+        ++size_;
+      }
+    } catch (...) {
+      Deallocate();
+      throw;
+    }
+  }
+
+  incremental_vector(const incremental_vector &v)
+      : incremental_vector(
+            alloc_traits::select_on_container_copy_construction(v.alloc_)) {
+    try {
+      CopyFrom(v);
+    } catch (...) {
+      Deallocate();
+      throw;
+    }
+  }
+
+  incremental_vector(incremental_vector &&v) noexcept
+      : alloc_(std::move(v.alloc_)),
+        data_(v.data_),
+        size_(v.size_),
+        capacity_(v.capacity_),
+        old_(v.old_),
+        old_capacity_(v.old_capacity_),
+        migrated_(v.migrated_),
+        old_size_(v.old_size_) {
+    v.Forget();
+  }
+
+  ~incremental_vector() noexcept { Deallocate(); }
+
+  incremental_vector &operator=(const incremental_vector &v) {
+    if (this != &v) {
+      if (alloc_traits::propagate_on_container_copy_assignment::value &&
+          alloc_ != v.alloc_) {
+        Deallocate();
+      }
+
+      if (alloc_traits::propagate_on_container_copy_assignment::value) {
+        alloc_ = v.alloc_;
+      }
+
+      clear();
+      CopyFrom(v);
+    }
+
+    return *this;
+  }
+
+  incremental_vector &operator=(incremental_vector &&v) noexcept(
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value) {
+    if (this != &v) {
+      if (alloc_traits::propagate_on_container_move_assignment::value ||
+          alloc_ == v.alloc_) {
+        Deallocate();
+
+        if (alloc_traits::propagate_on_container_move_assignment::value) {
+          alloc_ = std::move(v.alloc_);
+        }
+
+        data_ = v.data_;
+        size_ = v.size_;
+        capacity_ = v.capacity_;
+        old_ = v.old_;
+        old_capacity_ = v.old_capacity_;
+        migrated_ = v.migrated_;
+        old_size_ = v.old_size_;
+        v.Forget();
+      } else {
+        clear();
+        reserve(v.size_);
+
+        for (; size_ < v.size_; ++size_) {
+          alloc_traits::construct(alloc_, data_ + size_, std::move(v[size_]));
+        }
+
+        v.clear();
+      }
+    }
+
+    return *this;
+  }
+
+  allocator_type get_allocator() const noexcept { return alloc_; }
+
+  // Element access
+  reference at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("Index out of bounds");
+    }
+
+    return (*this)[pos];
+  }
+
+  reference operator[](size_type pos) const noexcept {
+    return (pos - migrated_ < old_size_ - migrated_) ? old_[pos] : data_[pos];
+  }
+
+  const_reference front() const noexcept { return (*this)[0]; }
+
+  const_reference back() const noexcept { return (*this)[size_ - 1]; }
+
+  // Contiguous storage; finishes a pending migration first.
+  pointer data() {
+    complete_migration();
+    return data_;
+  }
+
+  // Iterators
+  iterator begin() const noexcept { return iterator(this, 0); }
+
+  iterator end() const noexcept { return iterator(this, size_); }
+
+  // Capacity
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept {
+    size_type limit =
+        std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+    size_type alloc_limit = alloc_traits::max_size(alloc_);
+
+    return alloc_limit < limit ? alloc_limit : limit;
+  }
+
+  void reserve(size_type size) {
+    if (size <= capacity_) {
+      return;
+    }
+
+    if (size > max_size()) {
+      throw std::length_error("Out of container's limit");
+    }
+
+    complete_migration();
+    Reallocate(size);
+  }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+  void shrink_to_fit() {
+    complete_migration();
+
+    if (size_ != capacity_) {
+      Reallocate(size_);
+    }
+  }
+
+  // True while some elements still live in the previous buffer.
+  bool migrating() const noexcept { return old_ != nullptr; }
+
+  // Moves all remaining elements out of the previous buffer, e.g. during an
+  // idle period.
+  void complete_migration() {
+    while (migrating()) {
+      Migrate(old_size_ - migrated_);
+    }
+  }
+
+  // Modifiers
+  void clear() noexcept {
+    for (size_type i = 0; i < size_; ++i) {
+      alloc_traits::destroy(alloc_, &(*this)[i]);
+    }
+
+    size_ = 0;
+    migrated_ = old_size_ = 0;
+    FreeOld();
+  }
+
+  iterator insert(iterator pos, const_reference value) {
+    size_type index = pos.GetIndex();
+
+    if (index > size_) {
+      throw std::out_of_range("Index out of bounds");
+    }
+
+    value_type copy(value);
+    complete_migration();
+    GrowIfFull();
+    complete_migration();
+
+    if (index == size_) {
+      alloc_traits::construct(alloc_, data_ + size_, std::move(copy));
+    } else {
+      alloc_traits::construct(alloc_, data_ + size_,
+                              std::move(data_[size_ - 1]));
+
+      for (size_type i = size_ - 1; i > index; --i) {
+        data_[i] = std::move(data_[i - 1]);
+      }
+
+      data_[index] = std::move(copy);
+    }
+
+    ++size_;
+    return iterator(this, index);
+  }
+
+  void erase(iterator pos) {
+    size_type index = pos.GetIndex();
+
+    if (index >= size_) {
+      throw std::out_of_range("Index out of bounds");
+    }
+
+    complete_migration();
+
+    for (size_type i = index; i < size_ - 1; ++i) {
+      data_[i] = std::move(data_[i + 1]);
+    }
+
+    alloc_traits::destroy(alloc_, data_ + size_ - 1);
+    --size_;
+  }
+
+  void push_back(const_reference value) {
+    if (size_ < capacity_) {
+      alloc_traits::construct(alloc_, data_ + size_, value);
+    } else {
+      value_type copy(value);
+      GrowIfFull();
+      alloc_traits::construct(alloc_, data_ + size_, std::move(copy));
+    }
+
+    ++size_;
+    Migrate(kMigrationStep);
+  }
+
+  void pop_back() {
+    if (size_ > 0) {
+      --size_;
+      alloc_traits::destroy(alloc_, &(*this)[size_]);
+
+      if (size_ < old_size_) {
+        old_size_ = size_;
+      }
+
+      Migrate(kMigrationStep);
+    }
+  }
+
+  void swap(incremental_vector &other) noexcept {
+    if (alloc_traits::propagate_on_container_swap::value) {
+      std::swap(alloc_, other.alloc_);
+    }
+
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(old_, other.old_);
+    std::swap(old_capacity_, other.old_capacity_);
+    std::swap(migrated_, other.migrated_);
+    std::swap(old_size_, other.old_size_);
+  }
+
+ private:
+  // Starts a new migration: the current buffer becomes the old one and a
+  // bigger buffer becomes the target of new elements.
+  void GrowIfFull() {
+    if (size_ < capacity_) {
+      return;
+    }
+
+    complete_migration();
+
+    size_type new_capacity = growth_policy::next_capacity(
+        capacity_, size_ + 1, sizeof(value_type));
+    new_capacity = new_capacity < max_size() ? new_capacity : max_size();
+    if (new_capacity <= capacity_) {
+      throw std::length_error("Out of container's limit");
+    }
+
+    pointer new_data = alloc_traits::allocate(alloc_, new_capacity);
+
+    if (size_ > 0) {
+      old_ = data_;
+      old_capacity_ = capacity_;
+      migrated_ = 0;
+      old_size_ = size_;
+    } else if (data_) {
+      alloc_traits::deallocate(alloc_, data_, capacity_);
+    }
+
+    data_ = new_data;
+    capacity_ = new_capacity;
+  }
+
+  // Moves up to count elements from the old buffer into the new one.
+  void Migrate(size_type count) {
+    if (!migrating()) {
+      return;
+    }
+
+    size_type stop = migrated_ + count;
+    if (stop > old_size_) {
+      stop = old_size_;
+    }
+
+    for (; migrated_ < stop; ++migrated_) {
+      alloc_traits::construct(alloc_, data_ + migrated_,
+                              std::move_if_noexcept(old_[migrated_]));
+      alloc_traits::destroy(alloc_, old_ + migrated_);
+    }
+
+    if (migrated_ == old_size_) {
+      migrated_ = old_size_ = 0;
+      FreeOld();
+    }
+  }
+
+  void FreeOld() noexcept {
+    if (old_) {
+      alloc_traits::deallocate(alloc_, old_, old_capacity_);
+      old_ = nullptr;
+      old_capacity_ = 0;
+    }
+  }
+
+  void CopyFrom(const incremental_vector &v) {
+    reserve(v.size_);
+
+    for (; size_ < v.size_; ++size_) {
+      alloc_traits::construct(alloc_, data_ + size_, v[size_]);
+    }
+  }
+
+  // Moves every element into a buffer of new_capacity; requires that no
+  // migration is pending. The old elements are destroyed only once all of
+  // them have been built in the new buffer, so a throwing copy leaves the
+  // vector as it was.
+  void Reallocate(size_type new_capacity) {
+    pointer new_data = nullptr;
+
+    if (new_capacity > 0) {
+      new_data = alloc_traits::allocate(alloc_, new_capacity);
+    }
+
+    size_type built = 0;
+
+    try {
+      for (; built < size_; ++built) {
+        alloc_traits::construct(alloc_, new_data + built,
+                                std::move_if_noexcept(data_[built]));
+      }
+    } catch (...) {
+      for (size_type i = 0; i < built; ++i) {
+        alloc_traits::destroy(alloc_, new_data + i);
+      }
+
+      if (new_data) {
+        alloc_traits::deallocate(alloc_, new_data, new_capacity);
+      }
+
+      throw;
+    }
+
+    if (data_) {
+      for (size_type i = 0; i < size_; ++i) {
+        alloc_traits::destroy(alloc_, data_ + i);
+      }
+
+      alloc_traits::deallocate(alloc_, data_, capacity_);
+    }
+
+    data_ = new_data;
+    capacity_ = new_capacity;
+  }
+
+  void Deallocate() noexcept {
+    clear();
+
+    if (data_) {
+      alloc_traits::deallocate(alloc_, data_, capacity_);
+      data_ = nullptr;
+      capacity_ = 0;
+    }
+  }
+
+  void Forget() noexcept {
+    data_ = old_ = nullptr;
+    size_ = capacity_ = old_capacity_ = 0;
+    migrated_ = old_size_ = 0;
+  }
+
+  allocator_type alloc_;
+  pointer data_;
+  size_type size_;
+  size_type capacity_;
+  // Previous buffer while a migration is in progress. Elements with indices
+  // in [migrated_, old_size_) still live there; all others are in data_.
+  pointer old_;
+  size_type old_capacity_;
+  size_type migrated_;
+  size_type old_size_;
+};
+}  // namespace s21
+
+#endif  // S21_INCREMENTAL_VECTOR_H
@@ -0,0 +1,436 @@
+#ifndef S21_INTRUSIVE_LIST_H
+#define S21_INTRUSIVE_LIST_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+template <typename T, typename Tag>
+class intrusive_list;
+
+// Links embedded in an object so that it can be put into an
+// s21::intrusive_list<T, Tag> without allocating. An object joins one list
+// per hook it derives from; use distinct tags to be in several lists at
+// once. A linked object unlinks itself when it is destroyed. Copies of an
+// object start out unlinked.
+template <typename Tag = void>
+class intrusive_list_hook {
+ public:
+  intrusive_list_hook() noexcept = default;
+
+  intrusive_list_hook(const intrusive_list_hook &) noexcept {}
+
+  intrusive_list_hook &operator=(const intrusive_list_hook &) noexcept {
+    return *this;
+  }
+
+  ~intrusive_list_hook() noexcept { unlink(); }
+
+  bool is_linked() const noexcept { return next_ != nullptr; }
+
+  // Removes the object from whatever list it is in, in O(1).
+  void unlink() noexcept {
+    if (is_linked()) {
+      prev_->next_ = next_;
+      next_->prev_ = prev_;
+      next_ = prev_ = nullptr;
+    }
+  }
+
+ private:
+  template <typename, typename>
+  friend class intrusive_list;
+
+  intrusive_list_hook *next_ = nullptr;
+  intrusive_list_hook *prev_ = nullptr;
+};
+
+// Doubly linked list of objects that derive from intrusive_list_hook<Tag>.
+// The list never allocates, copies or destroys elements; it only links the
+// hooks of objects that live elsewhere, which must outlive their membership
+// or be destroyed (and thereby unlinked) first. Because elements can leave
+// the list on their own, size() counts the elements in O(n).
+template <typename T, typename Tag = void>
+class intrusive_list {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using hook_type = intrusive_list_hook<Tag>;
+
+ private:
+  class IntrusiveListIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+
+    explicit IntrusiveListIterator(hook_type *p = nullptr) : ptr_(p) {}
+
+    reference operator*() const noexcept { return Value(ptr_); }
+    value_type *operator->() const noexcept { return &Value(ptr_); }
+
+    bool operator!=(const IntrusiveListIterator &rhs) const noexcept {
+      return ptr_ != rhs.ptr_;
+    }
+    bool operator==(const IntrusiveListIterator &rhs) const noexcept {
+      return ptr_ == rhs.ptr_;
+    }
+
+    IntrusiveListIterator operator++(int) noexcept {
+      IntrusiveListIterator temp = *this;
+      ptr_ = ptr_->next_;
+      return temp;
+    }
+    IntrusiveListIterator &operator++() noexcept {
+      ptr_ = ptr_->next_;
+      return *this;
+    }
+
+    IntrusiveListIterator operator--(int) noexcept {
+      IntrusiveListIterator temp = *this;
+      ptr_ = ptr_->prev_;
+      return temp;
+    }
+    IntrusiveListIterator &operator--() noexcept {
+      ptr_ = ptr_->prev_;
+      return *this;
+    }
+
+    hook_type *GetPtr() const noexcept { return ptr_; }
+
+   private:
+    hook_type *ptr_ = nullptr;
+  };
+
+ public:
+  using iterator = IntrusiveListIterator;
+  using const_iterator = const IntrusiveListIterator;
+
+  intrusive_list() noexcept { Reset(); }
+
+  intrusive_list(const intrusive_list &) = delete;
+
+  intrusive_list(intrusive_list &&l) noexcept {
+    Reset();
+    splice(end(), l);
+  }
+
+  ~intrusive_list() noexcept { clear(); }
+
+  intrusive_list &operator=(const intrusive_list &) = delete;
+
+  intrusive_list &operator=(intrusive_list &&l) noexcept {
+    if (this != &l) {
+      clear();
+      splice(end(), l);
+    }
+
+    return *this;
+  }
+
+  // Element access
+  reference front() const noexcept { return Value(sentinel_.next_); }
+
+  reference back() const noexcept { return Value(sentinel_.prev_); }
+
+  // Iterators
+  iterator begin() const noexcept { return iterator(sentinel_.next_); }
+
+  iterator end() const noexcept {
+    return iterator(const_cast<hook_type *>(&sentinel_));
+  }
+
+  // Iterator to an element known to be in this list.
+  static iterator iterator_to(reference value) noexcept {
+    return iterator(&Hook(value));
+  }
+
+  // Capacity
+  bool empty() const noexcept { return sentinel_.next_ == &sentinel_; }
+
+  size_type size() const noexcept {
+    size_type count = 0;
+    for (hook_type *hook = sentinel_.next_; hook != &sentinel_;
+         hook = hook->next_) {
+      ++count;
+    }
+
+    return count;
+  }
+
+  // Modifiers
+  // Unlinks every element; the elements themselves are left untouched.
+  void clear() noexcept {
+    hook_type *current = sentinel_.next_;
+
+    while (current != &sentinel_) {
+      hook_type *next = current->next_;
+      current->next_ = current->prev_ = nullptr;
+      current = next;
+    }
+
+    Reset();
+  }
+
+  iterator insert(iterator pos, reference value) {
+    hook_type *hook = &Hook(value);
+    if (hook->is_linked()) {
+      throw std::invalid_argument("Element is already linked");
+    }
+
+    LinkBefore(pos.GetPtr(), hook, hook);
+    return iterator(hook);
+  }
+
+  void erase(iterator pos) {
+    if (pos == end()) {
+      throw std::invalid_argument("End or empty");
+    }
+
+    pos.GetPtr()->unlink();
+  }
+
+  // Unlinks value, which must be in this list, in O(1).
+  void erase(reference value) noexcept { Hook(value).unlink(); }
+
+  void push_back(reference value) { insert(end(), value); }
+
+  void pop_back() noexcept {
+    if (!empty()) {
+      sentinel_.prev_->unlink();
+    }
+  }
+
+  void push_front(reference value) { insert(begin(), value); }
+
+  void pop_front() noexcept {
+    if (!empty()) {
+      sentinel_.next_->unlink();
+    }
+  }
+
+  void swap(intrusive_list &other) noexcept {
+    intrusive_list temp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(temp);
+  }
+
+  // Operations
+  void merge(intrusive_list &other) { merge(other, std::less<>()); }
+
+  // Merges the sorted other into this sorted list by relinking hooks; on
+  // ties elements of this list come first.
+  template <typename Compare>
+  void merge(intrusive_list &other, Compare comp) {
+    if (this == &other || other.empty()) {
+      return;
+    }
+
+    hook_type *left = sentinel_.next_;
+    hook_type *right = other.sentinel_.next_;
+    hook_type **link = &sentinel_.next_;
+    sentinel_.prev_->next_ = nullptr;
+    other.sentinel_.prev_->next_ = nullptr;
+    other.Reset();
+
+    // If comp throws, the unmerged elements of both lists are kept at the
+    // end of this one.
+    try {
+      MergeRuns(left, right, link, comp);
+    } catch (...) {
+      AppendChains(link, {left, right});
+      CloseRing();
+      throw;
+    }
+
+    CloseRing();
+  }
+
+  // Moves all elements of other in front of pos in O(1).
+  void splice(const_iterator pos, intrusive_list &other) noexcept {
+    if (this != &other && !other.empty()) {
+      splice(pos, other, other.begin(), other.end());
+    }
+  }
+
+  // Moves the element at it from other in front of pos in O(1).
+  void splice(const_iterator pos, intrusive_list &other,
+              const_iterator it) noexcept {
+    splice(pos, other, it, std::next(it));
+  }
+
+  // Moves the elements of [first, last) from other in front of pos in O(1).
+  void splice(const_iterator pos, intrusive_list &, const_iterator first,
+              const_iterator last) noexcept {
+    hook_type *first_hook = first.GetPtr();
+    hook_type *last_hook = last.GetPtr()->prev_;
+
+    if (first == last || pos == first || pos == last) {
+      return;
+    }
+
+    first_hook->prev_->next_ = last.GetPtr();
+    last.GetPtr()->prev_ = first_hook->prev_;
+
+    LinkBefore(pos.GetPtr(), first_hook, last_hook);
+  }
+
+  void reverse() noexcept {
+    hook_type *current = &sentinel_;
+
+    do {
+      std::swap(current->next_, current->prev_);
+      current = current->prev_;
+    } while (current != &sentinel_);
+  }
+
+  // Unlinks all but the first of every run of equal elements.
+  void unique() noexcept {
+    hook_type *current = sentinel_.next_;
+
+    while (current != &sentinel_ && current->next_ != &sentinel_) {
+      if (Value(current) == Value(current->next_)) {
+        current->next_->unlink();
+      } else {
+        current = current->next_;
+      }
+    }
+  }
+
+  void sort() { sort(std::less<>()); }
+
+  // Stable bottom-up merge sort that only relinks hooks.
+  template <typename Compare>
+  void sort(Compare comp) {
+    if (empty() || sentinel_.next_ == sentinel_.prev_) {
+      return;
+    }
+
+    sentinel_.prev_->next_ = nullptr;
+
+    for (size_type width = 1;; width *= 2) {
+      hook_type *rest = sentinel_.next_;
+      hook_type **link = &sentinel_.next_;
+      size_type runs = 0;
+
+      while (rest) {
+        hook_type *left = rest;
+        hook_type *right = CutAfter(left, width);
+        rest = CutAfter(right, width);
+
+        // A throwing comp leaves the list complete but partly sorted.
+        try {
+          MergeRuns(left, right, link, comp);
+        } catch (...) {
+          AppendChains(link, {left, right, rest});
+          CloseRing();
+          throw;
+        }
+
+        ++runs;
+      }
+
+      if (runs == 1) {
+        break;
+      }
+    }
+
+    CloseRing();
+  }
+
+ private:
+  static reference Value(hook_type *hook) noexcept {
+    return static_cast<reference>(*hook);
+  }
+
+  static hook_type &Hook(reference value) noexcept { return value; }
+
+  void Reset() noexcept { sentinel_.next_ = sentinel_.prev_ = &sentinel_; }
+
+  // Links the chain first..last in front of pos.
+  static void LinkBefore(hook_type *pos, hook_type *first,
+                         hook_type *last) noexcept {
+    hook_type *prev = pos->prev_;
+
+    first->prev_ = prev;
+    last->next_ = pos;
+    prev->next_ = first;
+    pos->prev_ = last;
+  }
+
+  // Detaches the hooks following the first count hooks of run and returns
+  // the first detached hook.
+  static hook_type *CutAfter(hook_type *run, size_type count) noexcept {
+    for (size_type i = 1; run && i < count; ++i) {
+      run = run->next_;
+    }
+
+    if (run == nullptr) {
+      return nullptr;
+    }
+
+    hook_type *rest = run->next_;
+    run->next_ = nullptr;
+    return rest;
+  }
+
+  // Stably merges two null-terminated runs into *link, following next
+  // pointers only, and leaves link at the next field of the last merged
+  // hook. If comp throws, left and right hold the unmerged rest of each run
+  // and link the field they belong behind.
+  template <typename Compare>
+  static void MergeRuns(hook_type *&left, hook_type *&right,
+                        hook_type **&link, Compare &comp) {
+    while (left && right) {
+      if (comp(Value(right), Value(left))) {
+        *link = right;
+        right = right->next_;
+      } else {
+        *link = left;
+        left = left->next_;
+      }
+      link = &(*link)->next_;
+    }
+
+    AppendChains(link, {left, right});
+  }
+
+  // Links the null-terminated chains one after another into *link and
+  // leaves link at the next field of the last hook.
+  static void AppendChains(hook_type **&link,
+                           std::initializer_list<hook_type *> chains) noexcept {
+    for (hook_type *chain : chains) {
+      *link = chain;
+      while (*link) {
+        link = &(*link)->next_;
+      }
+    }
+  }
+
+  // Restores prev pointers and closes the ring through the sentinel after
+  // the next chain starting at sentinel_.next_ was rebuilt null-terminated.
+  void CloseRing() noexcept {
+    hook_type *prev = &sentinel_;
+
+    for (hook_type *hook = sentinel_.next_; hook; hook = hook->next_) {
+      hook->prev_ = prev;
+      prev = hook;
+    }
+
+    prev->next_ = &sentinel_;
+    sentinel_.prev_ = prev;
+  }
+
+  hook_type sentinel_;
+};
+}  // namespace s21
+
+#endif  // S21_INTRUSIVE_LIST_H
@@ -1,35 +1,80 @@
 #ifndef S21_LIST_H
 #define S21_LIST_H
 
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
 #include <limits>
+#include <memory>
 #include <stdexcept>
 #include <utility>
 
 namespace s21 {
-template <typename T>
+// Doubly linked list built around a sentinel node embedded in the list
+// object: the nodes form a ring through the sentinel, end() points at it and
+// --end() is the last element. Insertions and removals never have to check
+// for the first or the last node.
+template <typename T, typename Allocator = std::allocator<T>>
 class list {
  public:
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T &;
   using const_reference = const value_type &;
   using size_type = size_t;
 
  private:
-  struct ListNode {
-    explicit ListNode(const value_type &value)
-        : data(value), next(nullptr), prev(nullptr){};
+  struct NodeBase {
+    NodeBase *next;
+    NodeBase *prev;
+  };
+
+  struct ListNode : NodeBase {
+    template <typename... Args>
+    explicit ListNode(Args &&...args)
+        : NodeBase{nullptr, nullptr}, data(std::forward<Args>(args)...) {}
 
     value_type data;
-    ListNode *next;
-    ListNode *prev;
   };
 
+  using node_allocator_type = typename std::allocator_traits<
+      allocator_type>::template rebind_alloc<ListNode>;
+  using node_traits = std::allocator_traits<node_allocator_type>;
+
+  // Contiguous run of nodes laid out by compact(). Its nodes are destroyed
+  // one at a time, the storage is released once no list refers to it.
+  struct Block {
+    ListNode *nodes;
+    size_type count;
+    size_type owners;
+  };
+
+  // Entry in the chain of blocks whose nodes a list may hold.
+  struct BlockRef {
+    Block *block;
+    BlockRef *next;
+  };
+
+  using block_allocator_type = typename std::allocator_traits<
+      allocator_type>::template rebind_alloc<Block>;
+  using block_traits = std::allocator_traits<block_allocator_type>;
+  using ref_allocator_type = typename std::allocator_traits<
+      allocator_type>::template rebind_alloc<BlockRef>;
+  using ref_traits = std::allocator_traits<ref_allocator_type>;
+
   class ListIterator {
    public:
-    explicit ListIterator(ListNode *p = 0) : ptr_(p) {}
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+
+    explicit ListIterator(NodeBase *p = nullptr) : ptr_(p) {}
 
-    reference operator*() const noexcept { return ptr_->data; }
-    value_type *operator->() const noexcept { return &(ptr_->data); }
+    reference operator*() const noexcept { return Value(ptr_); }
+    value_type *operator->() const noexcept { return &Value(ptr_); }
 
     bool operator!=(const ListIterator &rhs) const noexcept {
       return this->ptr_ != rhs.ptr_;
@@ -39,8 +84,9 @@ class list {
     }
 
     ListIterator operator++(int) noexcept {
+      ListIterator temp = *this;
       ptr_ = ptr_->next;
-      return *this;
+      return temp;
     }
     ListIterator &operator++() noexcept {
       ptr_ = ptr_->next;
@@ -48,82 +94,120 @@ class list {
     }
 
     ListIterator operator--(int) noexcept {
+      ListIterator temp = *this;
       ptr_ = ptr_->prev;
-      return *this;
+      return temp;
     }
     ListIterator &operator--() noexcept {
       ptr_ = ptr_->prev;
       return *this;
     }
 
-    ListNode *GetPtr() const noexcept { return ptr_; }
+    NodeBase *GetPtr() const noexcept { return ptr_; }
 
    private:
-    ListNode *ptr_ = nullptr;
+    NodeBase *ptr_ = nullptr;
   };
 
  public:
   using iterator = ListIterator;
   using const_iterator = const ListIterator;
 
-  list() noexcept : head_(nullptr), tail_(nullptr), size_(0){};
+  list() noexcept : size_(0){};
 
-  explicit list(size_type n) : head_(nullptr), tail_(nullptr), size_(0) {
+  explicit list(const allocator_type &alloc) noexcept
+      : alloc_(alloc), size_(0) {}
+
+  explicit list(size_type n, const allocator_type &alloc = allocator_type())
+      : alloc_(alloc), size_(0) {
     if (n >= max_size()) {
       throw std::out_of_range("Out of container's limit");
     }
 
     for (size_type i = 0; i < n; ++i) {
-      push_back(value_type());
+      emplace_back();
     }
   }
 
-  list(const std::initializer_list<value_type> &items) noexcept
-      : head_(nullptr), tail_(nullptr), size_(0) {
+  list(const std::initializer_list<value_type> &items,
+       const allocator_type &alloc = allocator_type())
+      : alloc_(alloc), size_(0) {
     for (const T &item : items) {
       this->push_back(item);
     }
   }
 
-  list(const list &l) noexcept : head_(nullptr), tail_(nullptr), size_(0) {
-    ListNode *current = l.head_;
+  list(const list &l)
+      : alloc_(node_traits::select_on_container_copy_construction(l.alloc_)),
+        size_(0) {
+    this->CopyFrom(l);
+  }
 
-    while (current != nullptr) {
-      this->push_back(current->data);
-      current = current->next;
-    }
+  list(const list &l, const allocator_type &alloc) : alloc_(alloc), size_(0) {
+    this->CopyFrom(l);
   }
 
-  list(list &&l) noexcept : head_(nullptr), tail_(nullptr), size_(0) {
-    this->swap(l);
+  list(list &&l) noexcept : alloc_(std::move(l.alloc_)), size_(0) {
+    SwapNodes(l);
   }
 
-  ~list() noexcept {
-    ListNode *current(this->head_);
+  ~list() noexcept { clear(); }
 
-    while (current) {
-      ListNode *next(current->next);
-      delete current;
-      current = next;
+  list &operator=(const list &l) {
+    if (this != &l) {
+      this->clear();
+
+      if (node_traits::propagate_on_container_copy_assignment::value) {
+        alloc_ = l.alloc_;
+      }
+
+      this->CopyFrom(l);
     }
+
+    return *this;
   }
 
-  list &operator=(list &&l) noexcept {
-    this->clear();
-    this->swap(l);
+  list &operator=(list &&l) noexcept(
+      node_traits::propagate_on_container_move_assignment::value ||
+      node_traits::is_always_equal::value) {
+    if (this != &l) {
+      this->clear();
+
+      if (node_traits::propagate_on_container_move_assignment::value ||
+          alloc_ == l.alloc_) {
+        if (node_traits::propagate_on_container_move_assignment::value) {
+          alloc_ = std::move(l.alloc_);
+        }
+
+        SwapNodes(l);
+      } else {
+        for (NodeBase *node = l.sentinel_.next; node != &l.sentinel_;
+             node = node->next) {
+          emplace_back(std::move(Value(node)));
+        }
+
+        l.clear();
+      }
+    }
 
     return *this;
   }
 
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(alloc_);
+  }
+
   // Element access
-  const_reference front() const noexcept { return this->head_->data; }
+  const_reference front() const noexcept { return Value(sentinel_.next); }
 
-  const_reference back() const noexcept { return this->tail_->data; }
+  const_reference back() const noexcept { return Value(sentinel_.prev); }
 
   // Iterators
-  iterator begin() const noexcept { return iterator(this->head_); }
+  iterator begin() const noexcept { return iterator(sentinel_.next); }
 
-  iterator end() const noexcept { return iterator(this->tail_); }
+  iterator end() const noexcept {
+    return iterator(const_cast<NodeBase *>(&sentinel_));
+  }
 
   // Capacity
   bool empty() const noexcept { return this->size_ == 0; }
@@ -136,279 +220,631 @@ class list {
 
   // Modifiers
   void clear() noexcept {
-    while (!this->empty()) {
-      this->pop_back();
+    NodeBase *current = sentinel_.next;
+
+    while (current != &sentinel_) {
+      NodeBase *next = current->next;
+      DestroyNode(current);
+      current = next;
     }
+
+    Reset();
+    ReleaseBlocks();
   }
 
-  iterator insert(iterator pos, const_reference value) noexcept {
-    auto *new_node = new ListNode(value);
+  iterator insert(iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
 
-    if (pos == this->begin()) {
-      new_node->next = this->head_;
-      new_node->prev = nullptr;
-      if (this->head_) {
-        this->head_->prev = new_node;
-      }
-      this->head_ = new_node;
-    } else if (pos == this->end()) {
-      new_node->next = nullptr;
-      new_node->prev = this->tail_;
-      if (this->tail_) {
-        this->tail_->next = new_node;
-      }
-      this->tail_ = new_node;
-    } else {
-      auto *current_node = pos.GetPtr();
-      new_node->next = current_node;
-      new_node->prev = current_node->prev;
-      current_node->prev->next = new_node;
-      current_node->prev = new_node;
-    }
+  iterator insert(iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
 
-    ++this->size_;
-    return iterator(new_node);
+  // Constructs the element in place inside a new node in front of pos.
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    NodeBase *node = CreateNode(std::forward<Args>(args)...);
+    LinkBefore(pos.GetPtr(), node, node, 1);
+    return iterator(node);
   }
 
   void erase(iterator pos) {
-    if (pos == this->end() || empty()) {
+    if (pos == this->end()) {
       throw std::invalid_argument("End or empty");
     }
 
-    auto *current_node = pos.GetPtr();
+    EraseNode(pos.GetPtr());
+  }
 
-    if (current_node == this->head_) {
-      this->head_ = current_node->next;
-      if (this->head_) {
-        this->head_->prev = nullptr;
-      }
-    } else if (current_node == this->tail_) {
-      this->tail_ = current_node->prev;
-      if (this->tail_) {
-        this->tail_->next = nullptr;
-      }
-    } else {
-      current_node->prev->next = current_node->next;
-      current_node->next->prev = current_node->prev;
+  void push_back(const_reference value) { emplace(end(), value); }
+
+  void push_back(value_type &&value) { emplace(end(), std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    return *emplace(end(), std::forward<Args>(args)...);
+  }
+
+  void pop_back() noexcept {
+    if (!empty()) {
+      EraseNode(sentinel_.prev);
     }
+  }
 
-    delete current_node;
-    --this->size_;
+  void push_front(const_reference value) { emplace(begin(), value); }
+
+  void push_front(value_type &&value) { emplace(begin(), std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_front(Args &&...args) {
+    return *emplace(begin(), std::forward<Args>(args)...);
   }
 
-  void push_back(const_reference value) noexcept {
-    auto *node = new ListNode(value);
+  void pop_front() noexcept {
+    if (!empty()) {
+      EraseNode(sentinel_.next);
+    }
+  }
 
-    node->prev = this->tail_;
-    node->next = nullptr;
+  void swap(list &other) noexcept {
+    if (node_traits::propagate_on_container_swap::value) {
+      std::swap(alloc_, other.alloc_);
+    }
 
-    if (this->tail_) {
-      this->tail_->next = node;
+    SwapNodes(other);
+  }
+
+  // Operations
+  void merge(list &other) { merge(other, std::less<>()); }
+
+  // Merges the sorted other into this sorted list by relinking its nodes;
+  // on ties elements of this list come first. As with splice, only nodes
+  // that compact() placed in blocks make it allocate.
+  template <typename Compare>
+  void merge(list &other, Compare comp) {
+    if (this == &other || other.empty()) {
+      return;
     }
 
-    this->tail_ = node;
+    ShareBlocks(other);
 
-    if (this->head_ == nullptr) {
-      this->head_ = node;
+    size_type count = other.size_;
+    NodeBase *left = sentinel_.next;
+    NodeBase *right = other.sentinel_.next;
+    NodeBase **link = &sentinel_.next;
+    sentinel_.prev->next = nullptr;
+    other.sentinel_.prev->next = nullptr;
+    size_ += count;
+    other.Reset();
+
+    // If comp throws, the unmerged nodes of both lists are kept at the end
+    // of this one.
+    try {
+      MergeRuns(left, right, link, comp);
+    } catch (...) {
+      AppendChains(link, {left, right});
+      CloseRing();
+      throw;
     }
 
-    ++this->size_;
+    CloseRing();
   }
 
-  void pop_back() noexcept {
-    if (this->tail_) {
-      auto *node = this->tail_;
+  // Moves all nodes of other in front of pos in O(1). Only moving nodes
+  // that compact() placed in blocks allocates, to record the blocks here.
+  void splice(const_iterator pos, list &other) {
+    if (this == &other || other.empty()) {
+      return;
+    }
 
-      this->tail_ = this->tail_->prev;
+    ShareBlocks(other);
 
-      if (this->tail_) {
-        this->tail_->next = nullptr;
-      } else {
-        this->head_ = nullptr;
-      }
+    NodeBase *first = other.sentinel_.next;
+    NodeBase *last = other.sentinel_.prev;
+    size_type count = other.size_;
 
-      delete node;
-      --this->size_;
-    }
+    other.Unlink(first, last, count);
+    LinkBefore(pos.GetPtr(), first, last, count);
   }
 
-  void push_front(const_reference value) noexcept {
-    auto *node = new ListNode(value);
+  // Moves the node at it from other in front of pos in O(1).
+  void splice(const_iterator pos, list &other, const_iterator it) {
+    NodeBase *node = it.GetPtr();
+    NodeBase *target = pos.GetPtr();
+
+    if (node == target || node->next == target) {
+      return;
+    }
+
+    if (this != &other) {
+      if (Block *block = other.FindBlock(node)) {
+        ShareBlock(block);
+      }
+    }
+
+    other.Unlink(node, node, 1);
+    LinkBefore(target, node, node, 1);
+  }
 
-    node->next = this->head_;
-    node->prev = nullptr;
+  // Moves the nodes of [first, last) from other in front of pos. Only
+  // pointers are rewired; moving between different lists walks the range
+  // once to keep both sizes up to date.
+  void splice(const_iterator pos, list &other, const_iterator first,
+              const_iterator last) {
+    NodeBase *first_node = first.GetPtr();
+    NodeBase *stop = last.GetPtr();
 
-    if (this->head_) {
-      this->head_->prev = node;
+    if (first_node == stop) {
+      return;
     }
 
-    this->head_ = node;
+    NodeBase *back = stop->prev;
+    size_type count = 0;
+    if (this != &other) {
+      ShareBlocks(other);
 
-    if (this->tail_ == nullptr) {
-      this->tail_ = node;
+      for (NodeBase *node = first_node; node != stop; node = node->next) {
+        ++count;
+      }
     }
 
-    ++this->size_;
+    other.Unlink(first_node, back, count);
+    LinkBefore(pos.GetPtr(), first_node, back, count);
   }
 
-  void pop_front() noexcept {
-    if (this->head_) {
-      auto *node = this->head_;
+  // Swaps the links of every node, the sentinel included.
+  void reverse() noexcept {
+    NodeBase *current = &sentinel_;
 
-      this->head_ = this->head_->next;
+    do {
+      std::swap(current->next, current->prev);
+      current = current->prev;
+    } while (current != &sentinel_);
+  }
 
-      if (this->head_) {
-        this->head_->prev = nullptr;
-      } else {
-        this->tail_ = nullptr;
-      }
+  // Matching nodes are unlinked during the pass and destroyed after it, so
+  // value may refer to an element of the list. Returns the number removed.
+  size_type remove(const_reference value) {
+    return remove_if(
+        [&value](const_reference element) { return element == value; });
+  }
+
+  template <typename UnaryPredicate>
+  size_type remove_if(UnaryPredicate pred) {
+    NodeBase *removed = nullptr;
+    size_type count = 0;
+
+    try {
+      for (NodeBase *node = sentinel_.next; node != &sentinel_;) {
+        NodeBase *next = node->next;
+
+        if (pred(Value(node))) {
+          Unlink(node, node, 1);
+          node->next = removed;
+          removed = node;
+          ++count;
+        }
 
-      delete node;
-      --this->size_;
+        node = next;
+      }
+    } catch (...) {
+      DestroyChain(removed);
+      throw;
     }
+
+    DestroyChain(removed);
+    return count;
   }
 
-  void swap(list &other) noexcept {
-    std::swap(head_, other.head_);
-    std::swap(tail_, other.tail_);
-    std::swap(size_, other.size_);
+  size_type unique() { return unique(std::equal_to<>()); }
+
+  // Removes every element for which pred(kept, element) holds, where kept
+  // is the last element left in place. Returns the number removed.
+  template <typename BinaryPredicate>
+  size_type unique(BinaryPredicate pred) {
+    NodeBase *removed = nullptr;
+    size_type count = 0;
+
+    try {
+      NodeBase *kept = sentinel_.next;
+
+      for (NodeBase *node = kept->next; node != &sentinel_;) {
+        NodeBase *next = node->next;
+
+        if (pred(Value(kept), Value(node))) {
+          Unlink(node, node, 1);
+          node->next = removed;
+          removed = node;
+          ++count;
+        } else {
+          kept = node;
+        }
+
+        node = next;
+      }
+    } catch (...) {
+      DestroyChain(removed);
+      throw;
+    }
+
+    DestroyChain(removed);
+    return count;
   }
 
-  // Operations
-  void merge(list &other) noexcept {
-    if (this == &other || other.empty()) {
+  void sort() { sort(std::less<>()); }
+
+  // Stable bottom-up merge sort. Runs of width 1, 2, 4, ... are merged by
+  // relinking nodes, so elements are never copied or moved and no extra
+  // memory is used.
+  template <typename Compare>
+  void sort(Compare comp) {
+    if (size_ <= 1) {
       return;
     }
 
+    sentinel_.prev->next = nullptr;
+
+    for (size_type width = 1; width < size_; width *= 2) {
+      NodeBase *rest = sentinel_.next;
+      NodeBase **link = &sentinel_.next;
+
+      while (rest) {
+        NodeBase *left = rest;
+        NodeBase *right = CutAfter(left, width);
+        rest = CutAfter(right, width);
+
+        // A throwing comp leaves the list complete but partly sorted.
+        try {
+          MergeRuns(left, right, link, comp);
+        } catch (...) {
+          AppendChains(link, {left, right, rest});
+          CloseRing();
+          throw;
+        }
+      }
+    }
+
+    CloseRing();
+  }
+
+  // Moves the elements into one newly allocated block of nodes in list
+  // order, so that later traversals walk memory sequentially. Element
+  // addresses change and all iterators and references are invalidated;
+  // code that relies on stable addresses simply does not call it. Nodes
+  // inside a block are still erased one by one, but the block itself is
+  // kept until the list is cleared, destroyed or compacted again, and as
+  // long as another list holds nodes spliced out of it. The list finds a
+  // node's block by address among the few blocks it refers to, so nodes
+  // need no extra field. Does nothing if the list is already laid out this
+  // way.
+  void compact() {
     if (empty()) {
-      swap(other);
+      ReleaseBlocks();
       return;
     }
 
-    list merged_list;
+    if (IsCompact()) {
+      return;
+    }
 
-    auto it1 = begin();
-    auto it2 = other.begin();
+    BlockRef *ref = NewBlock(size_);
+    ListNode *nodes = ref->block->nodes;
+    size_type built = 0;
 
-    while (it1 != end() || it2 != other.end()) {
-      if (*it1 <= *it2) {
-        merged_list.push_back(*it1);
-        ++it1;
-      } else {
-        merged_list.push_back(*it2);
-        ++it2;
+    try {
+      for (NodeBase *node = sentinel_.next; node != &sentinel_;
+           node = node->next) {
+        node_traits::construct(alloc_, nodes + built,
+                               std::move_if_noexcept(Value(node)));
+        ++built;
       }
+    } catch (...) {
+      for (size_type i = 0; i < built; ++i) {
+        node_traits::destroy(alloc_, nodes + i);
+      }
+
+      ReleaseChain(ref);
+      throw;
     }
 
-    if (*it1 < *it2) {
-      merged_list.push_back(*it1);
-      merged_list.push_back(*it2);
-    } else {
-      merged_list.push_back(*it2);
-      merged_list.push_back(*it1);
+    for (NodeBase *node = sentinel_.next; node != &sentinel_;) {
+      NodeBase *next = node->next;
+      DestroyNode(node);
+      node = next;
     }
 
-    other.clear();
-    swap(merged_list);
+    ReleaseBlocks();
+    blocks_ = ref;
+
+    NodeBase *prev = &sentinel_;
+    for (size_type i = 0; i < built; ++i) {
+      nodes[i].prev = prev;
+      prev->next = nodes + i;
+      prev = nodes + i;
+    }
+
+    prev->next = &sentinel_;
+    sentinel_.prev = prev;
   }
 
-  void splice(const_iterator pos, list &other) noexcept {
-    if (this == &other || other.empty()) {
-      return;
+ private:
+  static reference Value(NodeBase *node) noexcept {
+    return static_cast<ListNode *>(node)->data;
+  }
+
+  // Links the chain first..last of count nodes in front of pos.
+  void LinkBefore(NodeBase *pos, NodeBase *first, NodeBase *last,
+                  size_type count) noexcept {
+    NodeBase *prev = pos->prev;
+
+    first->prev = prev;
+    last->next = pos;
+    prev->next = first;
+    pos->prev = last;
+
+    size_ += count;
+  }
+
+  // Detaches the chain first..last of count nodes without freeing it.
+  void Unlink(NodeBase *first, NodeBase *last, size_type count) noexcept {
+    first->prev->next = last->next;
+    last->next->prev = first->prev;
+
+    size_ -= count;
+  }
+
+  void EraseNode(NodeBase *node) noexcept {
+    Unlink(node, node, 1);
+    DestroyNode(node);
+  }
+
+  // Destroys a chain of unlinked nodes threaded through next.
+  void DestroyChain(NodeBase *node) noexcept {
+    while (node) {
+      NodeBase *next = node->next;
+      DestroyNode(node);
+      node = next;
     }
+  }
 
-    if (empty()) {
-      swap(other);
-      return;
+  // Makes the list empty without freeing its nodes.
+  void Reset() noexcept {
+    sentinel_.next = sentinel_.prev = &sentinel_;
+    size_ = 0;
+  }
+
+  // Exchanges the nodes of two lists. The sentinels stay where they are, so
+  // the first and the last node of each ring are repointed at their new one.
+  void SwapNodes(list &other) noexcept {
+    std::swap(sentinel_.next, other.sentinel_.next);
+    std::swap(sentinel_.prev, other.sentinel_.prev);
+    std::swap(size_, other.size_);
+    std::swap(blocks_, other.blocks_);
+
+    RepointEnds();
+    other.RepointEnds();
+  }
+
+  void RepointEnds() noexcept {
+    if (size_ == 0) {
+      Reset();
+    } else {
+      sentinel_.next->prev = &sentinel_;
+      sentinel_.prev->next = &sentinel_;
     }
+  }
 
-    iterator first = other.begin();
-    iterator last = other.end();
+  // Detaches the nodes following the first count nodes of run and returns
+  // the first detached node.
+  static NodeBase *CutAfter(NodeBase *run, size_type count) noexcept {
+    for (size_type i = 1; run && i < count; ++i) {
+      run = run->next;
+    }
 
-    while (first != last) {
-      iterator next = first;
-      ++next;
-      insert(pos, *first);
-      first = next;
+    if (run == nullptr) {
+      return nullptr;
     }
 
-    insert(pos, *first);
+    NodeBase *rest = run->next;
+    run->next = nullptr;
+    return rest;
+  }
 
-    other.clear();
+  // Stably merges two null-terminated runs into *link, following next
+  // pointers only, and leaves link at the next field of the last merged
+  // node. If comp throws, left and right hold the unmerged rest of each run
+  // and link the field they belong behind.
+  template <typename Compare>
+  static void MergeRuns(NodeBase *&left, NodeBase *&right, NodeBase **&link,
+                        Compare &comp) {
+    while (left && right) {
+      if (comp(Value(right), Value(left))) {
+        *link = right;
+        right = right->next;
+      } else {
+        *link = left;
+        left = left->next;
+      }
+      link = &(*link)->next;
+    }
+
+    AppendChains(link, {left, right});
   }
 
-  void reverse() noexcept {
-    if (size_ <= 1) {
-      return;
+  // Links the null-terminated chains one after another into *link and
+  // leaves link at the next field of the last node.
+  static void AppendChains(NodeBase **&link,
+                           std::initializer_list<NodeBase *> chains) noexcept {
+    for (NodeBase *chain : chains) {
+      *link = chain;
+      while (*link) {
+        link = &(*link)->next;
+      }
     }
+  }
 
-    ListNode *current = head_;
-    ListNode *temp;
+  // Restores prev pointers and closes the ring through the sentinel after
+  // the next chain starting at sentinel_.next was rebuilt null-terminated.
+  void CloseRing() noexcept {
+    NodeBase *prev = &sentinel_;
 
-    std::swap(head_, tail_);
+    for (NodeBase *node = sentinel_.next; node; node = node->next) {
+      node->prev = prev;
+      prev = node;
+    }
 
-    while (current != nullptr) {
-      temp = current->prev;
-      current->prev = current->next;
-      current->next = temp;
-      current = current->prev;
+    prev->next = &sentinel_;
+    sentinel_.prev = prev;
+  }
+
+  template <typename... Args>
+  ListNode *CreateNode(Args &&...args) {
+    ListNode *node = node_traits::allocate(alloc_, 1);
+
+    try {
+      node_traits::construct(alloc_, node, std::forward<Args>(args)...);
+    } catch (...) {
+      node_traits::deallocate(alloc_, node, 1);
+      throw;
     }
+
+    return node;
   }
 
-  void unique() noexcept {
-    if (size_ <= 1) {
-      return;
+  void DestroyNode(NodeBase *base) noexcept {
+    ListNode *node = static_cast<ListNode *>(base);
+    bool in_block = FindBlock(node) != nullptr;
+
+    node_traits::destroy(alloc_, node);
+
+    if (!in_block) {
+      node_traits::deallocate(alloc_, node, 1);
     }
+  }
 
-    ListNode *current = head_;
+  // Block of this list that holds node, or nullptr if the node was
+  // allocated on its own.
+  Block *FindBlock(const NodeBase *node) const noexcept {
+    std::less<const NodeBase *> less;
 
-    while (current != nullptr && current->next != nullptr) {
-      if (current->data == current->next->data) {
-        ListNode *duplicate = current->next;
-        current->next = duplicate->next;
+    for (BlockRef *ref = blocks_; ref; ref = ref->next) {
+      const ListNode *nodes = ref->block->nodes;
+      if (!less(node, nodes) && less(node, nodes + ref->block->count)) {
+        return ref->block;
+      }
+    }
 
-        if (duplicate->next != nullptr) {
-          duplicate->next->prev = current;
-        } else {
-          tail_ = current;
-        }
+    return nullptr;
+  }
 
-        --size_;
-      } else {
-        current = current->next;
+  // True if the nodes fill the only block exactly, in list order.
+  bool IsCompact() const noexcept {
+    if (blocks_ == nullptr || blocks_->next != nullptr ||
+        blocks_->block->count != size_) {
+      return false;
+    }
+
+    const ListNode *expected = blocks_->block->nodes;
+    for (const NodeBase *node = sentinel_.next; node != &sentinel_;
+         node = node->next) {
+      if (node != expected++) {
+        return false;
       }
     }
+
+    return true;
   }
 
-  void sort() noexcept {
-    if (size_ <= 1) {
-      return;
+  // Allocates storage for count nodes and returns the only entry of a new
+  // chain referring to it.
+  BlockRef *NewBlock(size_type count) {
+    block_allocator_type block_alloc(alloc_);
+    ref_allocator_type ref_alloc(alloc_);
+    ListNode *nodes = node_traits::allocate(alloc_, count);
+    Block *block = nullptr;
+    BlockRef *ref;
+
+    try {
+      block = block_traits::allocate(block_alloc, 1);
+      ref = ref_traits::allocate(ref_alloc, 1);
+    } catch (...) {
+      if (block) {
+        block_traits::deallocate(block_alloc, block, 1);
+      }
+
+      node_traits::deallocate(alloc_, nodes, count);
+      throw;
     }
 
-    bool swapped;
-    do {
-      swapped = false;
-      ListNode *current = head_;
-      ListNode *next_node = current->next;
-
-      while (next_node != nullptr) {
-        if (current->data > next_node->data) {
-          std::swap(current->data, next_node->data);
-          swapped = true;
-        }
+    block_traits::construct(block_alloc, block, Block{nodes, count, 1});
+    ref_traits::construct(ref_alloc, ref, BlockRef{block, nullptr});
+    return ref;
+  }
 
-        current = next_node;
-        next_node = next_node->next;
+  // Lets this list hold nodes of block, which other lists may also hold.
+  void ShareBlock(Block *block) {
+    for (BlockRef *ref = blocks_; ref; ref = ref->next) {
+      if (ref->block == block) {
+        return;
       }
-    } while (swapped);
+    }
+
+    ref_allocator_type ref_alloc(alloc_);
+    BlockRef *ref = ref_traits::allocate(ref_alloc, 1);
+    ref_traits::construct(ref_alloc, ref, BlockRef{block, blocks_});
+    blocks_ = ref;
+    ++block->owners;
   }
 
- private:
-  ListNode *head_;
-  ListNode *tail_;
+  // Called before nodes of other are moved here, as any of them may lie in
+  // one of its blocks.
+  void ShareBlocks(const list &other) {
+    for (BlockRef *ref = other.blocks_; ref; ref = ref->next) {
+      ShareBlock(ref->block);
+    }
+  }
+
+  // Drops the blocks of the list, which must hold none of their nodes.
+  void ReleaseBlocks() noexcept {
+    ReleaseChain(blocks_);
+    blocks_ = nullptr;
+  }
+
+  // Frees the entries of the chain, and every block no list refers to any
+  // more.
+  void ReleaseChain(BlockRef *ref) noexcept {
+    block_allocator_type block_alloc(alloc_);
+    ref_allocator_type ref_alloc(alloc_);
+
+    while (ref) {
+      BlockRef *next = ref->next;
+      Block *block = ref->block;
+
+      if (--block->owners == 0) {
+        node_traits::deallocate(alloc_, block->nodes, block->count);
+        block_traits::destroy(block_alloc, block);
+        block_traits::deallocate(block_alloc, block, 1);
+      }
+
+      ref_traits::destroy(ref_alloc, ref);
+      ref_traits::deallocate(ref_alloc, ref, 1);
+      ref = next;
+    }
+  }
+
+  void CopyFrom(const list &l) {
+    for (NodeBase *node = l.sentinel_.next; node != &l.sentinel_;
+         node = node->next) {
+      this->push_back(Value(node));
+    }
+  }
+
+  node_allocator_type alloc_;
+  NodeBase sentinel_{&sentinel_, &sentinel_};
+  BlockRef *blocks_ = nullptr;
 
   size_type size_;
 };
 }  // namespace s21
 
-#endif  // S21_LIST_H
\ No newline at end of file
+#endif  // S21_LIST_H
@@ -0,0 +1,295 @@
+#ifndef S21_LOCK_FREE_LIST_H
+#define S21_LOCK_FREE_LIST_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+#include "s21_epoch.h"
+
+namespace s21 {
+// Sorted set of unique keys that any number of threads may insert into,
+// erase from and read concurrently without locks (Harris' list with
+// Michael's in-search unlinking). A node is erased by first setting the
+// mark bit in its next link, which freezes it, and then unlinking it;
+// searches unlink marked nodes they pass. Unlinked nodes are retired to
+// the list's epoch_domain, so readers never touch freed memory. Elements
+// are immutable once inserted.
+template <typename T, typename Compare = std::less<T>>
+class lock_free_list {
+ public:
+  using value_type = T;
+  using key_compare = Compare;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+
+ private:
+  using Link = std::atomic<std::uintptr_t>;
+
+  static constexpr std::uintptr_t kMark = 1;
+
+  struct Node {
+    template <typename... Args>
+    explicit Node(Args &&...args) : value(std::forward<Args>(args)...) {}
+
+    const value_type value;
+    Link next{0};
+  };
+
+  static_assert(alignof(Node) > kMark, "the mark needs a free pointer bit");
+
+  class LockFreeListIterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T *;
+    using reference = const T &;
+
+    explicit LockFreeListIterator(Node *node = nullptr) : node_(node) {}
+
+    reference operator*() const noexcept { return node_->value; }
+    pointer operator->() const noexcept { return &node_->value; }
+
+    bool operator!=(const LockFreeListIterator &rhs) const noexcept {
+      return node_ != rhs.node_;
+    }
+    bool operator==(const LockFreeListIterator &rhs) const noexcept {
+      return node_ == rhs.node_;
+    }
+
+    LockFreeListIterator operator++(int) noexcept {
+      LockFreeListIterator temp = *this;
+      ++*this;
+      return temp;
+    }
+    LockFreeListIterator &operator++() noexcept {
+      node_ = Live(node_->next.load(std::memory_order_acquire));
+      return *this;
+    }
+
+   private:
+    Node *node_ = nullptr;
+  };
+
+ public:
+  using iterator = LockFreeListIterator;
+  using const_iterator = const LockFreeListIterator;
+
+  // Range over the elements that keeps the list's epoch domain pinned, so
+  // iterating is safe while other threads modify the list. Elements
+  // inserted or erased meanwhile may or may not be seen; the ones seen are
+  // in ascending order. Keep views short-lived: memory retired while any
+  // view is alive is not freed.
+  class view {
+   public:
+    iterator begin() const noexcept {
+      return iterator(Live(list_->head_.load(std::memory_order_acquire)));
+    }
+
+    iterator end() const noexcept { return iterator(); }
+
+   private:
+    friend class lock_free_list;
+
+    explicit view(const lock_free_list *list)
+        : list_(list), guard_(list->domain_.pin()) {}
+
+    const lock_free_list *list_;
+    epoch_domain::guard guard_;
+  };
+
+  lock_free_list() = default;
+
+  explicit lock_free_list(const key_compare &comp) : comp_(comp) {}
+
+  lock_free_list(const lock_free_list &) = delete;
+  lock_free_list &operator=(const lock_free_list &) = delete;
+
+  // Must not run concurrently with any other member.
+  ~lock_free_list() noexcept {
+    Node *node = Ptr(head_.load(std::memory_order_acquire));
+
+    while (node) {
+      Node *next = Ptr(node->next.load(std::memory_order_relaxed));
+      delete node;
+      node = next;
+    }
+  }
+
+  // Number of elements; exact only while no other thread modifies the list.
+  size_type size() const noexcept {
+    return size_.load(std::memory_order_relaxed);
+  }
+
+  bool empty() const noexcept { return size() == 0; }
+
+  // Returns false if an equal key is already present.
+  bool insert(const value_type &value) { return emplace(value); }
+
+  bool insert(value_type &&value) { return emplace(std::move(value)); }
+
+  template <typename... Args>
+  bool emplace(Args &&...args) {
+    epoch_domain::guard guard = domain_.pin();
+    Node *node = new Node(std::forward<Args>(args)...);
+    Link *prev;
+    Node *curr;
+
+    for (;;) {
+      if (Find(node->value, prev, curr, guard)) {
+        delete node;
+        return false;
+      }
+
+      node->next.store(Word(curr), std::memory_order_relaxed);
+      std::uintptr_t expected = Word(curr);
+      if (prev->compare_exchange_weak(expected, Word(node),
+                                      std::memory_order_release,
+                                      std::memory_order_relaxed)) {
+        size_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+      }
+    }
+  }
+
+  // Returns false if no equal key was present. The thread whose mark
+  // succeeds owns the erase; unlinking may be finished by another thread.
+  bool erase(const value_type &key) {
+    epoch_domain::guard guard = domain_.pin();
+    Link *prev;
+    Node *curr;
+
+    for (;;) {
+      if (!Find(key, prev, curr, guard)) {
+        return false;
+      }
+
+      std::uintptr_t next = curr->next.load(std::memory_order_acquire);
+      if ((next & kMark) ||
+          !curr->next.compare_exchange_weak(next, next | kMark,
+                                            std::memory_order_acq_rel,
+                                            std::memory_order_relaxed)) {
+        continue;
+      }
+
+      size_.fetch_sub(1, std::memory_order_relaxed);
+
+      std::uintptr_t expected = Word(curr);
+      if (prev->compare_exchange_strong(expected, next,
+                                        std::memory_order_acq_rel,
+                                        std::memory_order_relaxed)) {
+        guard.retire(curr, &DeleteNode);
+      } else {
+        Find(key, prev, curr, guard);
+      }
+
+      return true;
+    }
+  }
+
+  // Wait-free lookup that neither writes nor unlinks.
+  bool contains(const value_type &key) const {
+    epoch_domain::guard guard = domain_.pin();
+    Node *curr = Ptr(head_.load(std::memory_order_acquire));
+
+    while (curr && comp_(curr->value, key)) {
+      curr = Ptr(curr->next.load(std::memory_order_acquire));
+    }
+
+    return curr && !comp_(key, curr->value) &&
+           !(curr->next.load(std::memory_order_acquire) & kMark);
+  }
+
+  view snapshot() const { return view(this); }
+
+  // Calls fn on every element in ascending order while pinned.
+  template <typename Function>
+  void for_each(Function fn) const {
+    for (const value_type &value : snapshot()) {
+      fn(value);
+    }
+  }
+
+ private:
+  static Node *Ptr(std::uintptr_t word) noexcept {
+    return reinterpret_cast<Node *>(word & ~kMark);
+  }
+
+  static std::uintptr_t Word(Node *node) noexcept {
+    return reinterpret_cast<std::uintptr_t>(node);
+  }
+
+  // First node at or after word that is not marked as erased.
+  static Node *Live(std::uintptr_t word) noexcept {
+    Node *node = Ptr(word);
+
+    for (;;) {
+      if (node == nullptr) {
+        return nullptr;
+      }
+
+      std::uintptr_t next = node->next.load(std::memory_order_acquire);
+      if (!(next & kMark)) {
+        return node;
+      }
+
+      node = Ptr(next);
+    }
+  }
+
+  static void DeleteNode(void *node) { delete static_cast<Node *>(node); }
+
+  // Sets curr to the first node not less than key and prev to the link
+  // pointing at it. Marked nodes on the way are unlinked and retired; if
+  // the link to one changes under us the search starts over. Returns
+  // whether curr holds key.
+  bool Find(const value_type &key, Link *&prev, Node *&curr,
+            epoch_domain::guard &guard) {
+    for (;;) {
+      prev = &head_;
+      curr = Ptr(prev->load(std::memory_order_acquire));
+      bool restart = false;
+
+      while (curr) {
+        std::uintptr_t next = curr->next.load(std::memory_order_acquire);
+
+        if (next & kMark) {
+          std::uintptr_t expected = Word(curr);
+          if (!prev->compare_exchange_strong(expected, next & ~kMark,
+                                             std::memory_order_acq_rel,
+                                             std::memory_order_acquire)) {
+            restart = true;
+            break;
+          }
+
+          guard.retire(curr, &DeleteNode);
+          curr = Ptr(next);
+          continue;
+        }
+
+        if (!comp_(curr->value, key)) {
+          return !comp_(key, curr->value);
+        }
+
+        prev = &curr->next;
+        curr = Ptr(next);
+      }
+
+      if (!restart) {
+        return false;
+      }
+    }
+  }
+
+  Link head_{0};
+  std::atomic<size_type> size_{0};
+  key_compare comp_;
+  mutable epoch_domain domain_;
+};
+}  // namespace s21
+
+#endif  // S21_LOCK_FREE_LIST_H
@@ -0,0 +1,388 @@
+#ifndef S21_MAPPED_VECTOR_H
+#define S21_MAPPED_VECTOR_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+enum class mapped_mode { read_write, read_only };
+
+// vector whose storage is a memory-mapped file. The file holds a small header
+// (magic, element size, element count) followed by the elements, so the data
+// is available as soon as the file is mapped again. Growth extends the file
+// with ftruncate and remaps it; flush() makes the contents durable.
+template <typename T>
+class mapped_vector {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "mapped_vector stores raw bytes and needs a trivially "
+                "copyable type");
+  static_assert(alignof(T) <= 64, "over-aligned types are not supported");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using pointer = T *;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+
+ private:
+  class MappedVectorIterator {
+   public:
+    explicit MappedVectorIterator(pointer ptr) : ptr_(ptr) {}
+
+    reference operator*() const noexcept { return *ptr_; }
+    value_type *operator->() const noexcept { return ptr_; }
+
+    bool operator!=(const MappedVectorIterator &rhs) const noexcept {
+      return ptr_ != rhs.ptr_;
+    }
+    bool operator==(const MappedVectorIterator &rhs) const noexcept {
+      return ptr_ == rhs.ptr_;
+    }
+
+    bool operator<(const MappedVectorIterator &rhs) const noexcept {
+      return ptr_ < rhs.ptr_;
+    }
+    bool operator<=(const MappedVectorIterator &rhs) const noexcept {
+      return ptr_ <= rhs.ptr_;
+    }
+    bool operator>(const MappedVectorIterator &rhs) const noexcept {
+      return ptr_ > rhs.ptr_;
+    }
+    bool operator>=(const MappedVectorIterator &rhs) const noexcept {
+      return ptr_ >= rhs.ptr_;
+    }
+
+    MappedVectorIterator operator++(int) noexcept {
+      MappedVectorIterator temp = *this;
+      ++ptr_;
+      return temp;
+    }
+    MappedVectorIterator &operator++() noexcept {
+      ++ptr_;
+      return *this;
+    }
+    MappedVectorIterator operator--(int) noexcept {
+      MappedVectorIterator temp = *this;
+      --ptr_;
+      return temp;
+    }
+    MappedVectorIterator &operator--() noexcept {
+      --ptr_;
+      return *this;
+    }
+
+    pointer GetPtr() const noexcept { return ptr_; }
+
+   private:
+    pointer ptr_ = nullptr;
+  };
+
+  struct alignas(64) FileHeader {
+    uint64_t magic;
+    uint64_t value_size;
+    uint64_t size;
+  };
+
+  static constexpr uint64_t kMagic = 0x3132535f5645434bULL;
+
+ public:
+  using iterator = MappedVectorIterator;
+  using const_iterator = const MappedVectorIterator;
+
+  explicit mapped_vector(const std::string &path,
+                         mapped_mode mode = mapped_mode::read_write)
+      : fd_(-1), header_(nullptr), capacity_(0), mode_(mode) {
+    int flags = (mode == mapped_mode::read_only) ? O_RDONLY : O_RDWR | O_CREAT;
+    fd_ = ::open(path.c_str(), flags, 0644);
+    if (fd_ < 0) {
+      ThrowSystemError("Cannot open " + path);
+    }
+
+    try {
+      struct stat info;
+      if (::fstat(fd_, &info) != 0) {
+        ThrowSystemError("Cannot stat " + path);
+      }
+
+      size_type file_size = static_cast<size_type>(info.st_size);
+      if (file_size == 0 && mode == mapped_mode::read_write) {
+        Resize(FileBytes(0));
+        header_->magic = kMagic;
+        header_->value_size = sizeof(value_type);
+        header_->size = 0;
+      } else {
+        if (file_size < sizeof(FileHeader)) {
+          throw std::runtime_error("Not a mapped_vector file: " + path);
+        }
+
+        Map(file_size);
+        if (header_->magic != kMagic ||
+            header_->value_size != sizeof(value_type) ||
+            header_->size > capacity_) {
+          throw std::runtime_error("Not a mapped_vector file: " + path);
+        }
+      }
+    } catch (...) {
+      Close();
+      throw;
+    }
+  }
+
+  mapped_vector(const mapped_vector &) = delete;
+  mapped_vector &operator=(const mapped_vector &) = delete;
+
+  mapped_vector(mapped_vector &&v) noexcept
+      : fd_(v.fd_),
+        header_(v.header_),
+        capacity_(v.capacity_),
+        mode_(v.mode_) {
+    v.fd_ = -1;
+    v.header_ = nullptr;
+    v.capacity_ = 0;
+  }
+
+  ~mapped_vector() noexcept { Close(); }
+
+  mapped_vector &operator=(mapped_vector &&v) noexcept {
+    if (this != &v) {
+      Close();
+      std::swap(fd_, v.fd_);
+      std::swap(header_, v.header_);
+      std::swap(capacity_, v.capacity_);
+      std::swap(mode_, v.mode_);
+    }
+
+    return *this;
+  }
+
+  // Element access
+  reference at(size_type pos) const {
+    if (pos >= size()) {
+      throw std::out_of_range("Index out of bounds");
+    }
+
+    return data()[pos];
+  }
+
+  reference operator[](size_type pos) const noexcept { return data()[pos]; }
+
+  const_reference front() const noexcept { return data()[0]; }
+
+  const_reference back() const noexcept { return data()[size() - 1]; }
+
+  pointer data() const noexcept {
+    return header_ ? reinterpret_cast<pointer>(header_ + 1) : nullptr;
+  }
+
+  // Iterators
+  iterator begin() const noexcept { return iterator(data()); }
+
+  iterator end() const noexcept { return iterator(data() + size()); }
+
+  // Capacity
+  bool empty() const noexcept { return size() == 0; }
+
+  size_type size() const noexcept { return header_ ? header_->size : 0; }
+
+  size_type max_size() const noexcept {
+    return (std::numeric_limits<off_t>::max() - sizeof(FileHeader)) /
+           sizeof(value_type);
+  }
+
+  void reserve(size_type size) {
+    RequireWritable();
+
+    if (size <= capacity_) {
+      return;
+    }
+
+    if (size > max_size()) {
+      throw std::length_error("Out of container's limit");
+    }
+
+    Resize(FileBytes(size));
+  }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+  void shrink_to_fit() {
+    RequireWritable();
+
+    if (size() != capacity_) {
+      Resize(FileBytes(size()));
+    }
+  }
+
+  bool read_only() const noexcept { return mode_ == mapped_mode::read_only; }
+
+  // Writes dirty pages back to the file and waits for completion.
+  void flush() {
+    if (header_ && !read_only() &&
+        ::msync(header_, FileBytes(capacity_), MS_SYNC) != 0) {
+      ThrowSystemError("msync failed");
+    }
+  }
+
+  // Modifiers
+  void clear() {
+    RequireWritable();
+
+    if (header_) {
+      header_->size = 0;
+    }
+  }
+
+  iterator insert(iterator pos, const_reference value) {
+    RequireWritable();
+
+    size_type index = pos.GetPtr() - data();
+    if (index > size()) {
+      throw std::out_of_range("Index out of bounds");
+    }
+
+    value_type copy(value);
+    GrowIfFull();
+
+    for (size_type i = size(); i > index; --i) {
+      data()[i] = data()[i - 1];
+    }
+
+    data()[index] = copy;
+    ++header_->size;
+    return iterator(data() + index);
+  }
+
+  void erase(iterator pos) {
+    RequireWritable();
+
+    size_type index = pos.GetPtr() - data();
+    if (index >= size()) {
+      throw std::out_of_range("Index out of bounds");
+    }
+
+    for (size_type i = index; i + 1 < size(); ++i) {
+      data()[i] = data()[i + 1];
+    }
+
+    --header_->size;
+  }
+
+  void push_back(const_reference value) {
+    RequireWritable();
+
+    value_type copy(value);
+    GrowIfFull();
+
+    data()[size()] = copy;
+    ++header_->size;
+  }
+
+  void pop_back() {
+    RequireWritable();
+
+    if (size() > 0) {
+      --header_->size;
+    }
+  }
+
+  void swap(mapped_vector &other) noexcept {
+    std::swap(fd_, other.fd_);
+    std::swap(header_, other.header_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(mode_, other.mode_);
+  }
+
+ private:
+  static size_type FileBytes(size_type capacity) noexcept {
+    return sizeof(FileHeader) + capacity * sizeof(value_type);
+  }
+
+  [[noreturn]] static void ThrowSystemError(const std::string &what) {
+    throw std::system_error(errno, std::generic_category(), what);
+  }
+
+  void RequireWritable() const {
+    if (read_only()) {
+      throw std::logic_error("mapped_vector is read-only");
+    }
+  }
+
+  void GrowIfFull() {
+    if (size() >= capacity_) {
+      reserve((capacity_ == 0) ? 1 : capacity_ * 2);
+    }
+  }
+
+  void Map(size_type bytes) {
+    int prot = read_only() ? PROT_READ : PROT_READ | PROT_WRITE;
+    void *base = ::mmap(nullptr, bytes, prot, MAP_SHARED, fd_, 0);
+    if (base == MAP_FAILED) {
+      ThrowSystemError("mmap failed");
+    }
+
+    header_ = static_cast<FileHeader *>(base);
+    capacity_ = (bytes - sizeof(FileHeader)) / sizeof(value_type);
+  }
+
+  void Unmap() noexcept {
+    if (header_) {
+      ::munmap(header_, FileBytes(capacity_));
+      header_ = nullptr;
+    }
+
+    capacity_ = 0;
+  }
+
+  // Maps the file at its new length before unmapping the old view, so if
+  // mmap fails the vector keeps its previous mapping and capacity. The file
+  // is extended before mapping and truncated only after the smaller view
+  // has replaced the old one.
+  void Resize(size_type bytes) {
+    bool growing = header_ == nullptr || bytes > FileBytes(capacity_);
+
+    if (growing && ::ftruncate(fd_, static_cast<off_t>(bytes)) != 0) {
+      ThrowSystemError("ftruncate failed");
+    }
+
+    FileHeader *old_header = header_;
+    size_type old_bytes = FileBytes(capacity_);
+    Map(bytes);
+
+    if (old_header) {
+      ::munmap(old_header, old_bytes);
+    }
+
+    if (!growing && ::ftruncate(fd_, static_cast<off_t>(bytes)) != 0) {
+      ThrowSystemError("ftruncate failed");
+    }
+  }
+
+  void Close() noexcept {
+    Unmap();
+
+    if (fd_ >= 0) {
+      ::close(fd_);
+      fd_ = -1;
+    }
+  }
+
+  int fd_;
+  FileHeader *header_;
+  size_type capacity_;
+  mapped_mode mode_;
+};
+}  // namespace s21
+
+#endif  // S21_MAPPED_VECTOR_H
@@ -0,0 +1,317 @@
+#ifndef S21_MEMORY_H
+#define S21_MEMORY_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace s21 {
+// Growth policies decide the next capacity of a full buffer. `required` is
+// the smallest capacity that fits the pending insertion.
+struct doubling_growth {
+  static size_t next_capacity(size_t capacity, size_t required,
+                              size_t /*value_size*/) noexcept {
+    size_t grown = (capacity == 0) ? 1 : capacity * 2;
+    return grown < required ? required : grown;
+  }
+};
+
+struct golden_growth {
+  static size_t next_capacity(size_t capacity, size_t required,
+                              size_t /*value_size*/) noexcept {
+    size_t grown = capacity + capacity / 2;
+    if (grown <= capacity) {
+      grown = capacity + 1;
+    }
+    return grown < required ? required : grown;
+  }
+};
+
+// Grows by 1.5x and then rounds the byte size up to what the allocator would
+// hand out anyway: a power of two for small blocks, whole pages above that.
+struct size_class_growth {
+  static constexpr size_t kPageSize = 4096;
+
+  static size_t next_capacity(size_t capacity, size_t required,
+                              size_t value_size) noexcept {
+    size_t target = golden_growth::next_capacity(capacity, required, 0);
+    if (target > std::numeric_limits<size_t>::max() / value_size / 2) {
+      return target;
+    }
+
+    size_t bytes = target * value_size;
+    if (bytes <= kPageSize) {
+      size_t size_class = 16;
+      while (size_class < bytes) {
+        size_class *= 2;
+      }
+      bytes = size_class;
+    } else {
+      bytes = (bytes + kPageSize - 1) / kPageSize * kPageSize;
+    }
+
+    return bytes / value_size;
+  }
+};
+
+// Allocator backed by malloc/free that also exposes reallocate(). Containers
+// use reallocate() for trivially copyable elements, letting realloc extend
+// the block in place; glibc serves large blocks with mmap and grows them via
+// mremap, so even multi-gigabyte buffers are not copied.
+template <typename T>
+class malloc_allocator {
+ public:
+  using value_type = T;
+  using is_always_equal = std::true_type;
+
+  malloc_allocator() noexcept = default;
+
+  template <typename U>
+  malloc_allocator(const malloc_allocator<U> &) noexcept {}
+
+  T *allocate(size_t n) {
+    void *p = std::malloc(n * sizeof(T));
+    if (p == nullptr) {
+      throw std::bad_alloc();
+    }
+    return static_cast<T *>(p);
+  }
+
+  void deallocate(T *p, size_t) noexcept { std::free(p); }
+
+  T *reallocate(T *p, size_t /*old_n*/, size_t new_n) {
+    void *grown = std::realloc(p, new_n * sizeof(T));
+    if (grown == nullptr) {
+      throw std::bad_alloc();
+    }
+    return static_cast<T *>(grown);
+  }
+
+  template <typename U>
+  bool operator==(const malloc_allocator<U> &) const noexcept {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(const malloc_allocator<U> &) const noexcept {
+    return false;
+  }
+};
+
+// Allocator for large buffers. Blocks of at least `threshold` bytes are
+// carved out of an anonymous mapping that reserves `reservation` bytes of
+// address space up front (MAP_NORESERVE, MADV_HUGEPAGE). Physical pages are
+// committed on first touch and growth inside the reservation returns the same
+// pointer. s21::vector grows through reallocate() only when T is trivially
+// copyable, and then never copies while it grows; for other types it still
+// allocates a new block and moves the elements. Smaller blocks, and every block when transparent huge pages are not
+// available, come from malloc. Each block starts with a header recording how
+// it was obtained, so any instance can free any block.
+template <typename T>
+class huge_page_allocator {
+  static_assert(alignof(T) <= alignof(std::max_align_t),
+                "over-aligned types are not supported");
+
+ public:
+  using value_type = T;
+  using is_always_equal = std::true_type;
+
+  static constexpr size_t kDefaultThreshold = size_t(16) << 20;
+  static constexpr size_t kDefaultReservation = size_t(64) << 30;
+  static constexpr size_t kHugePageSize = size_t(2) << 20;
+  static constexpr size_t kPageSize = 4096;
+
+  explicit huge_page_allocator(
+      size_t threshold = kDefaultThreshold,
+      size_t reservation = kDefaultReservation) noexcept
+      : threshold_(threshold), reservation_(reservation) {}
+
+  template <typename U>
+  huge_page_allocator(const huge_page_allocator<U> &other) noexcept
+      : threshold_(other.threshold()), reservation_(other.reservation()) {}
+
+  size_t threshold() const noexcept { return threshold_; }
+
+  size_t reservation() const noexcept { return reservation_; }
+
+  T *allocate(size_t n) {
+    size_t bytes = n * sizeof(T) + kHeaderSize;
+
+    if (bytes >= threshold_ && HugePagesAvailable()) {
+      if (T *p = MapBlock(bytes)) {
+        return p;
+      }
+    }
+
+    return MallocBlock(bytes);
+  }
+
+  void deallocate(T *p, size_t) noexcept {
+    Header *header = HeaderOf(p);
+
+#ifdef __linux__
+    if (header->mapped_bytes != 0) {
+      munmap(header, header->mapped_bytes);
+      return;
+    }
+#endif
+
+    std::free(header);
+  }
+
+  T *reallocate(T *p, size_t old_n, size_t new_n) {
+    Header *header = HeaderOf(p);
+    size_t bytes = new_n * sizeof(T) + kHeaderSize;
+    (void)old_n;
+
+#ifdef __linux__
+    if (header->mapped_bytes != 0) {
+      if (bytes <= header->mapped_bytes) {
+        if (new_n < old_n) {
+          size_t keep = (bytes + kPageSize - 1) / kPageSize * kPageSize;
+          if (keep < header->mapped_bytes) {
+            madvise(reinterpret_cast<char *>(header) + keep,
+                    header->mapped_bytes - keep, MADV_DONTNEED);
+          }
+        }
+        return p;
+      }
+
+      size_t grown = RoundUp(bytes > header->mapped_bytes * 2
+                                 ? bytes
+                                 : header->mapped_bytes * 2);
+      void *moved =
+          mremap(header, header->mapped_bytes, grown, MREMAP_MAYMOVE);
+      if (moved == MAP_FAILED) {
+        throw std::bad_alloc();
+      }
+
+      madvise(moved, grown, MADV_HUGEPAGE);
+      static_cast<Header *>(moved)->mapped_bytes = grown;
+      return DataOf(static_cast<Header *>(moved));
+    }
+
+    if (bytes >= threshold_ && HugePagesAvailable()) {
+      if (T *mapped = MapBlock(bytes)) {
+        size_t old_bytes = (old_n < new_n ? old_n : new_n) * sizeof(T);
+        std::memcpy(static_cast<void *>(mapped), p, old_bytes);
+        std::free(header);
+        return mapped;
+      }
+    }
+#endif
+
+    void *grown = std::realloc(header, bytes);
+    if (grown == nullptr) {
+      throw std::bad_alloc();
+    }
+    return DataOf(static_cast<Header *>(grown));
+  }
+
+  static bool is_huge_page_backed(const T *p) noexcept {
+    return p != nullptr && HeaderOf(p)->mapped_bytes != 0;
+  }
+
+  static bool HugePagesAvailable() noexcept {
+#ifdef __linux__
+    static const bool available = [] {
+      std::ifstream mode("/sys/kernel/mm/transparent_hugepage/enabled");
+      std::string line;
+      return std::getline(mode, line) &&
+             line.find("[never]") == std::string::npos;
+    }();
+    return available;
+#else
+    return false;
+#endif
+  }
+
+  template <typename U>
+  bool operator==(const huge_page_allocator<U> &) const noexcept {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(const huge_page_allocator<U> &) const noexcept {
+    return false;
+  }
+
+ private:
+  struct alignas(std::max_align_t) Header {
+    size_t mapped_bytes;
+  };
+
+  static constexpr size_t kHeaderSize = sizeof(Header);
+
+  static Header *HeaderOf(const T *p) noexcept {
+    return reinterpret_cast<Header *>(
+        const_cast<char *>(reinterpret_cast<const char *>(p)) - kHeaderSize);
+  }
+
+  static T *DataOf(Header *header) noexcept {
+    return reinterpret_cast<T *>(reinterpret_cast<char *>(header) +
+                                 kHeaderSize);
+  }
+
+  static size_t RoundUp(size_t bytes) noexcept {
+    return (bytes + kHugePageSize - 1) / kHugePageSize * kHugePageSize;
+  }
+
+  T *MallocBlock(size_t bytes) {
+    auto *header = static_cast<Header *>(std::malloc(bytes));
+    if (header == nullptr) {
+      throw std::bad_alloc();
+    }
+
+    header->mapped_bytes = 0;
+    return DataOf(header);
+  }
+
+  T *MapBlock(size_t bytes) noexcept {
+#ifdef __linux__
+    size_t mapped_bytes = RoundUp(bytes > reservation_ ? bytes : reservation_);
+    void *base = mmap(nullptr, mapped_bytes, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (base == MAP_FAILED) {
+      return nullptr;
+    }
+
+    if (madvise(base, mapped_bytes, MADV_HUGEPAGE) != 0) {
+      munmap(base, mapped_bytes);
+      return nullptr;
+    }
+
+    static_cast<Header *>(base)->mapped_bytes = mapped_bytes;
+    return DataOf(static_cast<Header *>(base));
+#else
+    (void)bytes;
+    return nullptr;
+#endif
+  }
+
+  size_t threshold_;
+  size_t reservation_;
+};
+
+template <typename Allocator, typename = void>
+struct has_reallocate : std::false_type {};
+
+template <typename Allocator>
+struct has_reallocate<
+    Allocator,
+    std::void_t<decltype(std::declval<Allocator &>().reallocate(
+        std::declval<typename Allocator::value_type *>(), size_t(),
+        size_t()))>> : std::true_type {};
+}  // namespace s21
+
+#endif  // S21_MEMORY_H
@@ -0,0 +1,343 @@
+#ifndef S21_PARALLEL_H
+#define S21_PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+// Fixed set of worker threads executing index-space batches. The thread that
+// calls run() works on its own batch too, so nested run() calls made from
+// inside a task always make progress.
+class thread_pool {
+ public:
+  explicit thread_pool(size_t threads = DefaultThreads()) {
+    for (size_t i = 1; i < threads; ++i) {
+      workers_.emplace_back([this] { WorkerLoop(); });
+    }
+  }
+
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+
+  ~thread_pool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    wake_.notify_all();
+
+    for (auto &worker : workers_) {
+      worker.join();
+    }
+  }
+
+  // Number of threads taking part in a batch, the caller included.
+  size_t size() const noexcept { return workers_.size() + 1; }
+
+  // Calls body(i) for every i in [0, tasks) and returns once all calls have
+  // finished. The first exception thrown by a task is rethrown here.
+  void run(size_t tasks, const std::function<void(size_t)> &body) {
+    if (tasks == 0) {
+      return;
+    }
+
+    if (tasks == 1 || workers_.empty()) {
+      for (size_t i = 0; i < tasks; ++i) {
+        body(i);
+      }
+      return;
+    }
+
+    auto batch = std::make_shared<Batch>(body, tasks);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      queue_.push_back(batch);
+    }
+    wake_.notify_all();
+
+    Work(*batch);
+
+    {
+      std::unique_lock<std::mutex> lock(batch->mutex);
+      batch->done.wait(lock, [&] { return batch->finished == batch->count; });
+    }
+
+    if (batch->error) {
+      std::rethrow_exception(batch->error);
+    }
+  }
+
+  static thread_pool &instance() {
+    static thread_pool pool;
+    return pool;
+  }
+
+ private:
+  struct Batch {
+    Batch(const std::function<void(size_t)> &body, size_t count)
+        : body(body), count(count) {}
+
+    const std::function<void(size_t)> &body;
+    const size_t count;
+    std::atomic<size_t> next{0};
+    size_t finished = 0;
+    std::exception_ptr error;
+    std::mutex mutex;
+    std::condition_variable done;
+  };
+
+  static size_t DefaultThreads() noexcept {
+    size_t threads = std::thread::hardware_concurrency();
+    return threads == 0 ? 1 : threads;
+  }
+
+  void Work(Batch &batch) {
+    for (size_t i = batch.next++; i < batch.count; i = batch.next++) {
+      std::exception_ptr error;
+      try {
+        batch.body(i);
+      } catch (...) {
+        error = std::current_exception();
+      }
+
+      std::lock_guard<std::mutex> lock(batch.mutex);
+      if (error && !batch.error) {
+        batch.error = error;
+      }
+      if (++batch.finished == batch.count) {
+        batch.done.notify_all();
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = queue_.begin(); it != queue_.end(); ++it) {
+      if (it->get() == &batch) {
+        queue_.erase(it);
+        break;
+      }
+    }
+  }
+
+  void WorkerLoop() {
+    for (;;) {
+      std::shared_ptr<Batch> batch;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        wake_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+        if (queue_.empty()) {
+          return;
+        }
+        batch = queue_.front();
+      }
+
+      Work(*batch);
+    }
+  }
+
+  std::vector<std::thread> workers_;
+  std::deque<std::shared_ptr<Batch>> queue_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  bool stopping_ = false;
+};
+
+namespace parallel {
+struct options {
+  static constexpr size_t kDefaultGrain = size_t(1) << 14;
+
+  // Smallest number of elements handed to one task.
+  size_t grain = kDefaultGrain;
+  // Pool to run on; nullptr selects thread_pool::instance().
+  thread_pool *pool = nullptr;
+};
+
+namespace detail {
+inline thread_pool &PoolOf(const options &opts) {
+  return opts.pool ? *opts.pool : thread_pool::instance();
+}
+
+inline size_t ChunkCount(size_t n, const options &opts) {
+  size_t grain = opts.grain == 0 ? 1 : opts.grain;
+  return (n + grain - 1) / grain;
+}
+
+// Splits [0, n) into grain-sized chunks and runs body(begin, end) on each.
+template <typename Body>
+void ForChunks(size_t n, const options &opts, const Body &body) {
+  size_t chunks = ChunkCount(n, opts);
+  size_t grain = opts.grain == 0 ? 1 : opts.grain;
+
+  PoolOf(opts).run(chunks, [&](size_t chunk) {
+    size_t begin = chunk * grain;
+    size_t end = std::min(n, begin + grain);
+    body(begin, end);
+  });
+}
+
+// Number of elements the stable merge of a and b takes from a to produce its
+// first `out` elements.
+template <typename It, typename Compare>
+size_t CoRank(size_t out, It a, size_t a_size, It b, size_t b_size,
+              Compare comp) {
+  size_t lo = out > b_size ? out - b_size : 0;
+  size_t hi = std::min(out, a_size);
+
+  while (lo < hi) {
+    size_t i = lo + (hi - lo) / 2;
+    size_t j = out - i;
+    if (j > 0 && i < a_size && !comp(b[j - 1], a[i])) {
+      lo = i + 1;
+    } else {
+      hi = i;
+    }
+  }
+
+  return lo;
+}
+
+// One bottom-up merge sort round: merges neighbouring sorted runs of
+// `width` elements from src into dst. Output is cut into grain-sized pieces
+// that never straddle two runs, so the whole round is a single batch.
+template <typename Src, typename Dst, typename Compare>
+void MergeRound(Src src, Dst dst, size_t n, size_t width, Compare comp,
+                const options &opts) {
+  detail::ForChunks(n, opts, [&](size_t begin, size_t end) {
+    size_t lo = begin / (2 * width) * (2 * width);
+    size_t mid = std::min(n, lo + width);
+    size_t hi = std::min(n, lo + 2 * width);
+
+    Src a = src + lo;
+    Src b = src + mid;
+    size_t a_begin = CoRank(begin - lo, a, mid - lo, b, hi - mid, comp);
+    size_t a_end = CoRank(end - lo, a, mid - lo, b, hi - mid, comp);
+
+    std::merge(std::make_move_iterator(a + a_begin),
+               std::make_move_iterator(a + a_end),
+               std::make_move_iterator(b + (begin - lo - a_begin)),
+               std::make_move_iterator(b + (end - lo - a_end)), dst + begin,
+               comp);
+  });
+}
+}  // namespace detail
+
+template <typename It, typename Function>
+void for_each(It first, It last, Function f, const options &opts = options()) {
+  detail::ForChunks(last - first, opts, [&](size_t begin, size_t end) {
+    for (It it = first + begin, stop = first + end; it != stop; ++it) {
+      f(*it);
+    }
+  });
+}
+
+template <typename It, typename Out, typename Function>
+Out transform(It first, It last, Out d_first, Function f,
+              const options &opts = options()) {
+  size_t n = last - first;
+
+  detail::ForChunks(n, opts, [&](size_t begin, size_t end) {
+    std::transform(first + begin, first + end, d_first + begin, f);
+  });
+
+  return d_first + n;
+}
+
+template <typename It, typename T, typename BinaryOp = std::plus<T>>
+T reduce(It first, It last, T init, BinaryOp op = BinaryOp(),
+         const options &opts = options()) {
+  size_t n = last - first;
+  size_t chunks = detail::ChunkCount(n, opts);
+  if (chunks == 0) {
+    return init;
+  }
+
+  std::vector<T> partials(chunks, init);
+  size_t grain = opts.grain == 0 ? 1 : opts.grain;
+
+  detail::PoolOf(opts).run(chunks, [&](size_t chunk) {
+    It it = first + chunk * grain;
+    It stop = first + std::min(n, (chunk + 1) * grain);
+    T sum = *it;
+    for (++it; it != stop; ++it) {
+      sum = op(sum, *it);
+    }
+    partials[chunk] = sum;
+  });
+
+  for (const T &partial : partials) {
+    init = op(init, partial);
+  }
+
+  return init;
+}
+
+template <typename It, typename T>
+void fill(It first, It last, const T &value, const options &opts = options()) {
+  detail::ForChunks(last - first, opts, [&](size_t begin, size_t end) {
+    std::fill(first + begin, first + end, value);
+  });
+}
+
+template <typename It, typename Out>
+Out copy(It first, It last, Out d_first, const options &opts = options()) {
+  size_t n = last - first;
+
+  detail::ForChunks(n, opts, [&](size_t begin, size_t end) {
+    std::copy(first + begin, first + end, d_first + begin);
+  });
+
+  return d_first + n;
+}
+
+// Stable parallel merge sort: grain-sized runs are sorted concurrently, then
+// merged pairwise round by round, each round spread across the pool.
+template <typename It, typename Compare = std::less<
+                           typename std::iterator_traits<It>::value_type>>
+void sort(It first, It last, Compare comp = Compare(),
+          const options &opts = options()) {
+  using value_type = typename std::iterator_traits<It>::value_type;
+
+  size_t n = last - first;
+  size_t grain = opts.grain == 0 ? 1 : opts.grain;
+  if (n <= grain) {
+    std::stable_sort(first, last, comp);
+    return;
+  }
+
+  detail::ForChunks(n, opts, [&](size_t begin, size_t end) {
+    std::stable_sort(first + begin, first + end, comp);
+  });
+
+  std::unique_ptr<value_type[]> buffer(new value_type[n]);
+  bool in_buffer = false;
+
+  for (size_t width = grain; width < n; width *= 2) {
+    if (in_buffer) {
+      detail::MergeRound(buffer.get(), first, n, width, comp, opts);
+    } else {
+      detail::MergeRound(first, buffer.get(), n, width, comp, opts);
+    }
+
+    in_buffer = !in_buffer;
+  }
+
+  if (in_buffer) {
+    detail::ForChunks(n, opts, [&](size_t begin, size_t end) {
+      std::move(buffer.get() + begin, buffer.get() + end, first + begin);
+    });
+  }
+}
+}  // namespace parallel
+}  // namespace s21
+
+#endif  // S21_PARALLEL_H
@@ -0,0 +1,369 @@
+#ifndef S21_RADIX_SORT_H
+#define S21_RADIX_SORT_H
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "s21_parallel.h"
+#include "s21_vector.h"
+
+namespace s21 {
+namespace detail {
+template <size_t Size>
+struct UnsignedOf;
+template <>
+struct UnsignedOf<1> {
+  using type = uint8_t;
+};
+template <>
+struct UnsignedOf<2> {
+  using type = uint16_t;
+};
+template <>
+struct UnsignedOf<4> {
+  using type = uint32_t;
+};
+template <>
+struct UnsignedOf<8> {
+  using type = uint64_t;
+};
+
+// Maps a key to an unsigned integer with the same ordering, so that keys can
+// be sorted byte by byte. Negative floats have all bits flipped, everything
+// else only the sign bit; -0.0 sorts before 0.0 and NaNs sort by their bits.
+template <typename T>
+struct RadixTraits {
+  static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value,
+                "radix sort keys must be integers or floating point");
+  static_assert(sizeof(T) <= 8, "radix sort keys are at most 64 bits wide");
+
+  using bits_type = typename UnsignedOf<sizeof(T)>::type;
+
+  static constexpr size_t kDigits = sizeof(T);
+  static constexpr bits_type kSignBit =
+      bits_type(bits_type(1) << (8 * sizeof(T) - 1));
+
+  static bits_type ToBits(T value) noexcept {
+    bits_type bits;
+    std::memcpy(&bits, &value, sizeof(T));
+
+    if constexpr (std::is_floating_point<T>::value) {
+      return (bits & kSignBit) ? bits_type(~bits) : bits_type(bits | kSignBit);
+    } else if constexpr (std::is_signed<T>::value) {
+      return bits ^ kSignBit;
+    } else {
+      return bits;
+    }
+  }
+
+  static size_t Digit(T value, size_t digit) noexcept {
+    return (ToBits(value) >> (8 * digit)) & 0xff;
+  }
+};
+
+// Payload type of a plain key sort.
+struct NoPayload {};
+
+constexpr size_t kRadix = 256;
+constexpr size_t kSmallSort = 64;
+
+// Stable insertion sort by key bits, used for tiny ranges.
+template <typename K, typename V>
+void InsertionSort(K *keys, V *values, size_t n) {
+  using traits = RadixTraits<K>;
+
+  for (size_t i = 1; i < n; ++i) {
+    K key = keys[i];
+    size_t j = i;
+
+    if constexpr (std::is_same<V, NoPayload>::value) {
+      for (; j > 0 && traits::ToBits(key) < traits::ToBits(keys[j - 1]); --j) {
+        keys[j] = keys[j - 1];
+      }
+    } else {
+      V value = values[i];
+      for (; j > 0 && traits::ToBits(key) < traits::ToBits(keys[j - 1]); --j) {
+        keys[j] = keys[j - 1];
+        values[j] = values[j - 1];
+      }
+      values[j] = value;
+    }
+
+    keys[j] = key;
+  }
+}
+
+// Least-significant-digit radix sort on the low `digits` bytes of the keys.
+// All histograms are built in one read pass; passes over a byte that every
+// key shares are skipped. Elements ping-pong between the input and the
+// scratch arrays and end up back in the input.
+template <typename K, typename V>
+void LsdSort(K *keys, V *values, size_t n, K *key_scratch, V *value_scratch,
+             size_t digits) {
+  using traits = RadixTraits<K>;
+  constexpr bool kHasPayload = !std::is_same<V, NoPayload>::value;
+
+  if (n < kSmallSort) {
+    InsertionSort(keys, values, n);
+    return;
+  }
+
+  std::array<std::array<size_t, kRadix>, traits::kDigits> counts{};
+  for (size_t i = 0; i < n; ++i) {
+    auto bits = traits::ToBits(keys[i]);
+    for (size_t d = 0; d < digits; ++d) {
+      ++counts[d][(bits >> (8 * d)) & 0xff];
+    }
+  }
+
+  K *key_from = keys;
+  K *key_to = key_scratch;
+  V *value_from = values;
+  V *value_to = value_scratch;
+
+  for (size_t d = 0; d < digits; ++d) {
+    std::array<size_t, kRadix> &offsets = counts[d];
+    if (offsets[traits::Digit(key_from[0], d)] == n) {
+      continue;
+    }
+
+    size_t sum = 0;
+    for (size_t &offset : offsets) {
+      size_t count = offset;
+      offset = sum;
+      sum += count;
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+      size_t pos = offsets[traits::Digit(key_from[i], d)]++;
+      key_to[pos] = key_from[i];
+      if constexpr (kHasPayload) {
+        value_to[pos] = value_from[i];
+      }
+    }
+
+    std::swap(key_from, key_to);
+    std::swap(value_from, value_to);
+  }
+
+  if (key_from != keys) {
+    std::memcpy(static_cast<void *>(keys), key_from, n * sizeof(K));
+    if constexpr (kHasPayload) {
+      std::memcpy(static_cast<void *>(values), value_from, n * sizeof(V));
+    }
+  }
+}
+
+// One allocation holding the scratch keys followed by the scratch payload.
+template <typename K, typename V>
+class RadixScratch {
+  static_assert(std::is_same<V, NoPayload>::value ||
+                    std::is_trivially_copyable<V>::value,
+                "radix sort payloads must be trivially copyable");
+  static_assert(alignof(V) <= alignof(std::max_align_t),
+                "over-aligned payloads are not supported");
+
+ public:
+  explicit RadixScratch(size_t n) {
+    size_t value_offset = ValueOffset(n);
+    size_t bytes = value_offset;
+    if (!std::is_same<V, NoPayload>::value) {
+      bytes += n * sizeof(V);
+    }
+
+    block_.reset(new unsigned char[bytes]);
+    keys_ = reinterpret_cast<K *>(block_.get());
+    values_ = reinterpret_cast<V *>(block_.get() + value_offset);
+  }
+
+  K *keys() const noexcept { return keys_; }
+
+  V *values() const noexcept { return values_; }
+
+ private:
+  static size_t ValueOffset(size_t n) noexcept {
+    size_t bytes = n * sizeof(K);
+    return (bytes + alignof(V) - 1) / alignof(V) * alignof(V);
+  }
+
+  std::unique_ptr<unsigned char[]> block_;
+  K *keys_ = nullptr;
+  V *values_ = nullptr;
+};
+
+template <typename K, typename V>
+void RadixSort(K *keys, V *values, size_t n) {
+  if (n < kSmallSort) {
+    InsertionSort(keys, values, n);
+    return;
+  }
+
+  RadixScratch<K, V> scratch(n);
+  LsdSort(keys, values, n, scratch.keys(), scratch.values(),
+          RadixTraits<K>::kDigits);
+}
+
+// Parallel hybrid: keys are first partitioned on their most significant
+// varying byte (MSD), with per-chunk histograms and a stable parallel
+// scatter into the scratch arrays. Each of the up to 256 buckets is then
+// finished independently with an LSD sort on the lower bytes, using the
+// matching slice of the input as its scratch space.
+template <typename K, typename V>
+void ParallelRadixSort(K *keys, V *values, size_t n,
+                       const parallel::options &opts) {
+  using traits = RadixTraits<K>;
+  using bits_type = typename traits::bits_type;
+  constexpr bool kHasPayload = !std::is_same<V, NoPayload>::value;
+
+  size_t grain = opts.grain == 0 ? 1 : opts.grain;
+  if (n <= grain) {
+    RadixSort(keys, values, n);
+    return;
+  }
+
+  size_t chunks = parallel::detail::ChunkCount(n, opts);
+  thread_pool &pool = parallel::detail::PoolOf(opts);
+
+  bits_type first = traits::ToBits(keys[0]);
+  std::vector<bits_type> differences(chunks, 0);
+  parallel::detail::ForChunks(n, opts, [&](size_t begin, size_t end) {
+    bits_type difference = 0;
+    for (size_t i = begin; i < end; ++i) {
+      difference |= traits::ToBits(keys[i]) ^ first;
+    }
+    differences[begin / grain] = difference;
+  });
+
+  bits_type difference = 0;
+  for (bits_type chunk_difference : differences) {
+    difference |= chunk_difference;
+  }
+  if (difference == 0) {
+    return;
+  }
+
+  size_t top = traits::kDigits - 1;
+  while ((difference >> (8 * top)) == 0) {
+    --top;
+  }
+
+  std::vector<std::array<size_t, kRadix>> offsets(chunks);
+  parallel::detail::ForChunks(n, opts, [&](size_t begin, size_t end) {
+    std::array<size_t, kRadix> &counts = offsets[begin / grain];
+    counts.fill(0);
+    for (size_t i = begin; i < end; ++i) {
+      ++counts[traits::Digit(keys[i], top)];
+    }
+  });
+
+  std::array<size_t, kRadix + 1> buckets{};
+  size_t sum = 0;
+  for (size_t digit = 0; digit < kRadix; ++digit) {
+    buckets[digit] = sum;
+    for (size_t chunk = 0; chunk < chunks; ++chunk) {
+      size_t count = offsets[chunk][digit];
+      offsets[chunk][digit] = sum;
+      sum += count;
+    }
+  }
+  buckets[kRadix] = n;
+
+  RadixScratch<K, V> scratch(n);
+  K *key_scratch = scratch.keys();
+  V *value_scratch = scratch.values();
+
+  parallel::detail::ForChunks(n, opts, [&](size_t begin, size_t end) {
+    std::array<size_t, kRadix> &next = offsets[begin / grain];
+    for (size_t i = begin; i < end; ++i) {
+      size_t pos = next[traits::Digit(keys[i], top)]++;
+      key_scratch[pos] = keys[i];
+      if constexpr (kHasPayload) {
+        value_scratch[pos] = values[i];
+      }
+    }
+  });
+
+  std::vector<size_t> filled;
+  for (size_t digit = 0; digit < kRadix; ++digit) {
+    if (buckets[digit] != buckets[digit + 1]) {
+      filled.push_back(digit);
+    }
+  }
+
+  pool.run(filled.size(), [&](size_t task) {
+    size_t begin = buckets[filled[task]];
+    size_t size = buckets[filled[task] + 1] - begin;
+    V *bucket_values = nullptr;
+    V *bucket_scratch = nullptr;
+    if constexpr (kHasPayload) {
+      bucket_values = values + begin;
+      bucket_scratch = value_scratch + begin;
+    }
+
+    LsdSort(key_scratch + begin, bucket_scratch, size, keys + begin,
+            bucket_values, top);
+
+    std::memcpy(static_cast<void *>(keys + begin), key_scratch + begin,
+                size * sizeof(K));
+    if constexpr (kHasPayload) {
+      std::memcpy(static_cast<void *>(bucket_values), bucket_scratch,
+                  size * sizeof(V));
+    }
+  });
+}
+}  // namespace detail
+
+// Sorts integer or floating-point keys in ascending order in O(n) with
+// byte-wise LSD radix passes and one scratch buffer of n elements.
+template <typename T>
+void radix_sort(T *first, T *last) {
+  detail::RadixSort(first, static_cast<detail::NoPayload *>(nullptr),
+                    last - first);
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+void radix_sort(vector<T, Allocator, GrowthPolicy> &v) {
+  radix_sort(v.data(), v.data() + v.size());
+}
+
+// Stable sort of [keys_first, keys_last) that applies the same permutation
+// to the payload starting at values. Payloads must be trivially copyable.
+template <typename K, typename V>
+void radix_sort_by_key(K *keys_first, K *keys_last, V *values) {
+  detail::RadixSort(keys_first, values, keys_last - keys_first);
+}
+
+template <typename K, typename KA, typename KG, typename V, typename VA,
+          typename VG>
+void radix_sort_by_key(vector<K, KA, KG> &keys, vector<V, VA, VG> &values) {
+  if (keys.size() != values.size()) {
+    throw std::invalid_argument("Keys and values differ in size");
+  }
+
+  radix_sort_by_key(keys.data(), keys.data() + keys.size(), values.data());
+}
+
+namespace parallel {
+template <typename T>
+void radix_sort(T *first, T *last, const options &opts = options()) {
+  s21::detail::ParallelRadixSort(
+      first, static_cast<s21::detail::NoPayload *>(nullptr), last - first,
+      opts);
+}
+
+template <typename K, typename V>
+void radix_sort_by_key(K *keys_first, K *keys_last, V *values,
+                       const options &opts = options()) {
+  s21::detail::ParallelRadixSort(keys_first, values, keys_last - keys_first,
+                                 opts);
+}
+}  // namespace parallel
+}  // namespace s21
+
+#endif  // S21_RADIX_SORT_H
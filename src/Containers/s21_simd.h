@@ -0,0 +1,585 @@
+#ifndef S21_SIMD_H
+#define S21_SIMD_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+#include "s21_vector.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define S21_SIMD_X86 1
+#endif
+
+namespace s21 {
+namespace simd {
+enum class isa { scalar, sse2, avx2, avx512 };
+
+// Widest instruction set the CPU supports, detected once.
+inline isa detected_isa() noexcept {
+#ifdef S21_SIMD_X86
+  static const isa detected = [] {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") &&
+        __builtin_cpu_supports("avx512bw")) {
+      return isa::avx512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+      return isa::avx2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+      return isa::sse2;
+    }
+    return isa::scalar;
+  }();
+  return detected;
+#else
+  return isa::scalar;
+#endif
+}
+
+namespace detail {
+inline std::atomic<isa> &ActiveIsa() noexcept {
+  static std::atomic<isa> active(detected_isa());
+  return active;
+}
+
+template <typename T>
+struct Traits;
+
+template <>
+struct Traits<int> {
+  using accumulator = int64_t;
+  using lane = int64_t;
+  static constexpr size_t kFlushEvery = SIZE_MAX;
+};
+
+template <>
+struct Traits<uint8_t> {
+  using accumulator = uint64_t;
+  using lane = uint32_t;
+  // 65536 * 255 * 255 still fits a 32-bit lane.
+  static constexpr size_t kFlushEvery = size_t(1) << 16;
+};
+
+template <>
+struct Traits<float> {
+  using accumulator = float;
+  using lane = float;
+  static constexpr size_t kFlushEvery = SIZE_MAX;
+};
+
+template <>
+struct Traits<double> {
+  using accumulator = double;
+  using lane = double;
+  static constexpr size_t kFlushEvery = SIZE_MAX;
+};
+
+template <typename T>
+void RequireSupported() {
+  static_assert(std::is_same<T, int>::value || std::is_same<T, float>::value ||
+                    std::is_same<T, double>::value ||
+                    std::is_same<T, uint8_t>::value,
+                "s21::simd supports int, float, double and uint8_t");
+}
+
+// Scalar reference implementations, also used for the tails of SIMD loops.
+struct Scalar {
+  template <typename T>
+  static size_t Find(const T *data, size_t n, T value) noexcept {
+    size_t i = 0;
+    while (i < n && !(data[i] == value)) {
+      ++i;
+    }
+    return i;
+  }
+
+  template <typename T>
+  static size_t Count(const T *data, size_t n, T value) noexcept {
+    size_t count = 0;
+    for (size_t i = 0; i < n; ++i) {
+      count += data[i] == value;
+    }
+    return count;
+  }
+
+  template <typename T>
+  static T Min(const T *data, size_t n) noexcept {
+    T result = data[0];
+    for (size_t i = 1; i < n; ++i) {
+      result = data[i] < result ? data[i] : result;
+    }
+    return result;
+  }
+
+  template <typename T>
+  static T Max(const T *data, size_t n) noexcept {
+    T result = data[0];
+    for (size_t i = 1; i < n; ++i) {
+      result = data[i] > result ? data[i] : result;
+    }
+    return result;
+  }
+
+  template <typename T>
+  static typename Traits<T>::accumulator Sum(const T *data, size_t n) noexcept {
+    typename Traits<T>::accumulator sum = 0;
+    for (size_t i = 0; i < n; ++i) {
+      sum += data[i];
+    }
+    return sum;
+  }
+
+  template <typename T>
+  static typename Traits<T>::accumulator Dot(const T *a, const T *b,
+                                             size_t n) noexcept {
+    using accumulator = typename Traits<T>::accumulator;
+    accumulator sum = 0;
+    for (size_t i = 0; i < n; ++i) {
+      sum += static_cast<accumulator>(a[i]) * static_cast<accumulator>(b[i]);
+    }
+    return sum;
+  }
+
+  template <typename T>
+  static bool Equal(const T *a, const T *b, size_t n) noexcept {
+    for (size_t i = 0; i < n; ++i) {
+      if (!(a[i] == b[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+#ifdef S21_SIMD_X86
+template <typename T, size_t Bytes>
+struct VectorOf {
+  typedef T type __attribute__((vector_size(Bytes)));
+};
+
+// Kernels written once against GCC vector extensions. They are always
+// inlined into the target-specific entry points below, so the same source
+// compiles to SSE2, AVX2 or AVX-512 code depending on the caller.
+template <size_t Bytes>
+struct Kernels {
+  template <typename T>
+  using Vec = typename VectorOf<T, Bytes>::type;
+
+  template <typename T>
+  static constexpr size_t kLanes = Bytes / sizeof(T);
+
+  // Vectors only travel by reference: passing them by value between
+  // functions compiled for different targets would change the ABI.
+  template <typename V, typename T>
+  __attribute__((always_inline)) static inline void Load(V &v, const T *p) {
+    __builtin_memcpy(&v, p, Bytes);
+  }
+
+  template <typename Mask>
+  __attribute__((always_inline)) static inline bool Any(const Mask &mask) {
+    typename VectorOf<uint64_t, Bytes>::type bits;
+    __builtin_memcpy(&bits, &mask, Bytes);
+    uint64_t any = 0;
+    for (size_t i = 0; i < Bytes / sizeof(uint64_t); ++i) {
+      any |= bits[i];
+    }
+    return any != 0;
+  }
+
+  template <typename T>
+  __attribute__((always_inline)) static inline size_t Find(const T *data,
+                                                           size_t n, T value) {
+    const Vec<T> needle = Vec<T>{} + value;
+    size_t i = 0;
+    Vec<T> v;
+    for (; i + kLanes<T> <= n; i += kLanes<T>) {
+      Load(v, data + i);
+      if (Any(v == needle)) {
+        return i + Scalar::Find(data + i, kLanes<T>, value);
+      }
+    }
+    return i + Scalar::Find(data + i, n - i, value);
+  }
+
+  template <typename T>
+  __attribute__((always_inline)) static inline size_t Count(const T *data,
+                                                            size_t n,
+                                                            T value) {
+    using Mask = decltype(Vec<T>{} == Vec<T>{});
+    using Lane = typename std::remove_reference<decltype(Mask{}[0])>::type;
+    constexpr size_t kFlush =
+        sizeof(Lane) >= sizeof(size_t)
+            ? SIZE_MAX
+            : (size_t(1) << (8 * sizeof(Lane) - 1)) - 1;
+
+    const Vec<T> needle = Vec<T>{} + value;
+    Vec<T> v;
+    size_t count = 0;
+    size_t i = 0;
+    while (i + kLanes<T> <= n) {
+      Mask hits{};
+      for (size_t block = 0; block < kFlush && i + kLanes<T> <= n;
+           ++block, i += kLanes<T>) {
+        Load(v, data + i);
+        hits -= v == needle;
+      }
+      for (size_t lane = 0; lane < kLanes<T>; ++lane) {
+        count += static_cast<size_t>(hits[lane]);
+      }
+    }
+    return count + Scalar::Count(data + i, n - i, value);
+  }
+
+  template <typename T>
+  __attribute__((always_inline)) static inline T Min(const T *data, size_t n) {
+    if (n < kLanes<T>) {
+      return Scalar::Min(data, n);
+    }
+
+    Vec<T> acc;
+    Vec<T> v;
+    Load(acc, data);
+    size_t i = kLanes<T>;
+    for (; i + kLanes<T> <= n; i += kLanes<T>) {
+      Load(v, data + i);
+      acc = v < acc ? v : acc;
+    }
+
+    T result = acc[0];
+    for (size_t lane = 1; lane < kLanes<T>; ++lane) {
+      result = acc[lane] < result ? acc[lane] : result;
+    }
+    for (; i < n; ++i) {
+      result = data[i] < result ? data[i] : result;
+    }
+    return result;
+  }
+
+  template <typename T>
+  __attribute__((always_inline)) static inline T Max(const T *data, size_t n) {
+    if (n < kLanes<T>) {
+      return Scalar::Max(data, n);
+    }
+
+    Vec<T> acc;
+    Vec<T> v;
+    Load(acc, data);
+    size_t i = kLanes<T>;
+    for (; i + kLanes<T> <= n; i += kLanes<T>) {
+      Load(v, data + i);
+      acc = v > acc ? v : acc;
+    }
+
+    T result = acc[0];
+    for (size_t lane = 1; lane < kLanes<T>; ++lane) {
+      result = acc[lane] > result ? acc[lane] : result;
+    }
+    for (; i < n; ++i) {
+      result = data[i] > result ? data[i] : result;
+    }
+    return result;
+  }
+
+  template <typename T>
+  __attribute__((always_inline)) static inline typename Traits<T>::accumulator
+  Sum(const T *data, size_t n) {
+    return Dot<T, false>(data, nullptr, n);
+  }
+
+  // Widens every lane to Traits<T>::lane before multiplying and adding, and
+  // folds the lanes into the scalar accumulator before they could overflow.
+  template <typename T, bool kMultiply = true>
+  __attribute__((always_inline)) static inline typename Traits<T>::accumulator
+  Dot(const T *a, const T *b, size_t n) {
+    using Lane = typename Traits<T>::lane;
+    using Wide = typename VectorOf<Lane, kLanes<T> * sizeof(Lane)>::type;
+
+    typename Traits<T>::accumulator sum = 0;
+    Vec<T> v;
+    size_t i = 0;
+    while (i + kLanes<T> <= n) {
+      Wide acc{};
+      for (size_t block = 0;
+           block < Traits<T>::kFlushEvery && i + kLanes<T> <= n;
+           ++block, i += kLanes<T>) {
+        Load(v, a + i);
+        Wide x = __builtin_convertvector(v, Wide);
+        if constexpr (kMultiply) {
+          Load(v, b + i);
+          x *= __builtin_convertvector(v, Wide);
+        }
+        acc += x;
+      }
+      for (size_t lane = 0; lane < kLanes<T>; ++lane) {
+        sum += acc[lane];
+      }
+    }
+
+    if constexpr (kMultiply) {
+      return sum + Scalar::Dot(a + i, b + i, n - i);
+    } else {
+      return sum + Scalar::Sum(a + i, n - i);
+    }
+  }
+
+  template <typename T>
+  __attribute__((always_inline)) static inline bool Equal(const T *a,
+                                                          const T *b,
+                                                          size_t n) {
+    Vec<T> va;
+    Vec<T> vb;
+    size_t i = 0;
+    for (; i + kLanes<T> <= n; i += kLanes<T>) {
+      Load(va, a + i);
+      Load(vb, b + i);
+      if (Any(va != vb)) {
+        return false;
+      }
+    }
+    return Scalar::Equal(a + i, b + i, n - i);
+  }
+};
+
+// One entry point per instruction set; Op::Run forwards to Kernels<Bytes>.
+template <typename Op, typename... Args>
+__attribute__((target("sse2"))) auto RunSse2(Args... args) {
+  return Op::template Run<16>(args...);
+}
+
+template <typename Op, typename... Args>
+__attribute__((target("avx2"))) auto RunAvx2(Args... args) {
+  return Op::template Run<32>(args...);
+}
+
+template <typename Op, typename... Args>
+__attribute__((target("avx512f,avx512bw"))) auto RunAvx512(Args... args) {
+  return Op::template Run<64>(args...);
+}
+#endif
+
+template <typename Op, typename... Args>
+auto Dispatch(Args... args) {
+#ifdef S21_SIMD_X86
+  switch (ActiveIsa().load(std::memory_order_relaxed)) {
+    case isa::avx512:
+      return RunAvx512<Op>(args...);
+    case isa::avx2:
+      return RunAvx2<Op>(args...);
+    case isa::sse2:
+      return RunSse2<Op>(args...);
+    case isa::scalar:
+      break;
+  }
+#endif
+  return Op::Scalar(args...);
+}
+
+struct FindOp {
+  template <typename T>
+  static size_t Scalar(const T *data, size_t n, T value) {
+    return detail::Scalar::Find(data, n, value);
+  }
+#ifdef S21_SIMD_X86
+  template <size_t Bytes, typename T>
+  __attribute__((always_inline)) static inline size_t Run(const T *data,
+                                                          size_t n, T value) {
+    return Kernels<Bytes>::Find(data, n, value);
+  }
+#endif
+};
+
+struct CountOp {
+  template <typename T>
+  static size_t Scalar(const T *data, size_t n, T value) {
+    return detail::Scalar::Count(data, n, value);
+  }
+#ifdef S21_SIMD_X86
+  template <size_t Bytes, typename T>
+  __attribute__((always_inline)) static inline size_t Run(const T *data,
+                                                          size_t n, T value) {
+    return Kernels<Bytes>::Count(data, n, value);
+  }
+#endif
+};
+
+struct MinOp {
+  template <typename T>
+  static T Scalar(const T *data, size_t n) {
+    return detail::Scalar::Min(data, n);
+  }
+#ifdef S21_SIMD_X86
+  template <size_t Bytes, typename T>
+  __attribute__((always_inline)) static inline T Run(const T *data, size_t n) {
+    return Kernels<Bytes>::Min(data, n);
+  }
+#endif
+};
+
+struct MaxOp {
+  template <typename T>
+  static T Scalar(const T *data, size_t n) {
+    return detail::Scalar::Max(data, n);
+  }
+#ifdef S21_SIMD_X86
+  template <size_t Bytes, typename T>
+  __attribute__((always_inline)) static inline T Run(const T *data, size_t n) {
+    return Kernels<Bytes>::Max(data, n);
+  }
+#endif
+};
+
+struct SumOp {
+  template <typename T>
+  static typename Traits<T>::accumulator Scalar(const T *data, size_t n) {
+    return detail::Scalar::Sum(data, n);
+  }
+#ifdef S21_SIMD_X86
+  template <size_t Bytes, typename T>
+  __attribute__((always_inline)) static inline typename Traits<T>::accumulator
+  Run(const T *data, size_t n) {
+    return Kernels<Bytes>::Sum(data, n);
+  }
+#endif
+};
+
+struct DotOp {
+  template <typename T>
+  static typename Traits<T>::accumulator Scalar(const T *a, const T *b,
+                                                size_t n) {
+    return detail::Scalar::Dot(a, b, n);
+  }
+#ifdef S21_SIMD_X86
+  template <size_t Bytes, typename T>
+  __attribute__((always_inline)) static inline typename Traits<T>::accumulator
+  Run(const T *a, const T *b, size_t n) {
+    return Kernels<Bytes>::Dot(a, b, n);
+  }
+#endif
+};
+
+struct EqualOp {
+  template <typename T>
+  static bool Scalar(const T *a, const T *b, size_t n) {
+    return detail::Scalar::Equal(a, b, n);
+  }
+#ifdef S21_SIMD_X86
+  template <size_t Bytes, typename T>
+  __attribute__((always_inline)) static inline bool Run(const T *a, const T *b,
+                                                        size_t n) {
+    return Kernels<Bytes>::Equal(a, b, n);
+  }
+#endif
+};
+}  // namespace detail
+
+template <typename T>
+using accumulator_t = typename detail::Traits<T>::accumulator;
+
+// Instruction set used by the kernels. use_isa() lowers (or restores) it;
+// requests above detected_isa() are clamped.
+inline isa active_isa() noexcept { return detail::ActiveIsa().load(); }
+
+inline void use_isa(isa level) noexcept {
+  detail::ActiveIsa().store(level < detected_isa() ? level : detected_isa());
+}
+
+// Index of the first element equal to value, or n if there is none.
+template <typename T>
+size_t find(const T *data, size_t n, T value) {
+  detail::RequireSupported<T>();
+  return detail::Dispatch<detail::FindOp>(data, n, value);
+}
+
+template <typename T>
+size_t count(const T *data, size_t n, T value) {
+  detail::RequireSupported<T>();
+  return detail::Dispatch<detail::CountOp>(data, n, value);
+}
+
+template <typename T>
+T min(const T *data, size_t n) {
+  detail::RequireSupported<T>();
+  if (n == 0) {
+    throw std::invalid_argument("Empty range");
+  }
+  return detail::Dispatch<detail::MinOp>(data, n);
+}
+
+template <typename T>
+T max(const T *data, size_t n) {
+  detail::RequireSupported<T>();
+  if (n == 0) {
+    throw std::invalid_argument("Empty range");
+  }
+  return detail::Dispatch<detail::MaxOp>(data, n);
+}
+
+// Integers are summed in 64-bit accumulators. Floating-point sums are
+// reassociated across lanes, so they may differ from a sequential loop in
+// the last bits.
+template <typename T>
+accumulator_t<T> sum(const T *data, size_t n) {
+  detail::RequireSupported<T>();
+  return detail::Dispatch<detail::SumOp>(data, n);
+}
+
+template <typename T>
+accumulator_t<T> dot(const T *a, const T *b, size_t n) {
+  detail::RequireSupported<T>();
+  return detail::Dispatch<detail::DotOp>(a, b, n);
+}
+
+template <typename T>
+bool equal(const T *a, const T *b, size_t n) {
+  detail::RequireSupported<T>();
+  return detail::Dispatch<detail::EqualOp>(a, b, n);
+}
+
+// Overloads working directly on vector::data().
+template <typename T, typename A, typename G>
+size_t find(const vector<T, A, G> &v, T value) {
+  return find(v.data(), v.size(), value);
+}
+
+template <typename T, typename A, typename G>
+size_t count(const vector<T, A, G> &v, T value) {
+  return count(v.data(), v.size(), value);
+}
+
+template <typename T, typename A, typename G>
+T min(const vector<T, A, G> &v) {
+  return min(v.data(), v.size());
+}
+
+template <typename T, typename A, typename G>
+T max(const vector<T, A, G> &v) {
+  return max(v.data(), v.size());
+}
+
+template <typename T, typename A, typename G>
+accumulator_t<T> sum(const vector<T, A, G> &v) {
+  return sum(v.data(), v.size());
+}
+
+template <typename T, typename A, typename G>
+accumulator_t<T> dot(const vector<T, A, G> &a, const vector<T, A, G> &b) {
+  if (a.size() != b.size()) {
+    throw std::invalid_argument("Vectors differ in size");
+  }
+  return dot(a.data(), b.data(), a.size());
+}
+
+template <typename T, typename A, typename G>
+bool equal(const vector<T, A, G> &a, const vector<T, A, G> &b) {
+  return a.size() == b.size() && equal(a.data(), b.data(), a.size());
+}
+}  // namespace simd
+}  // namespace s21
+
+#undef S21_SIMD_X86
+
+#endif  // S21_SIMD_H
@@ -0,0 +1,364 @@
+#ifndef S21_SMALL_VECTOR_H
+#define S21_SMALL_VECTOR_H
+
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+template <typename T, size_t N = 8>
+class small_vector {
+  static_assert(N > 0, "small_vector needs at least one inline slot");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using pointer = T *;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+
+ private:
+  class SmallVectorIterator {
+   public:
+    explicit SmallVectorIterator(pointer ptr) : ptr_(ptr) {}
+
+    reference operator*() const noexcept { return *ptr_; }
+    value_type *operator->() const noexcept { return ptr_; }
+
+    bool operator!=(const SmallVectorIterator &rhs) const noexcept {
+      return ptr_ != rhs.ptr_;
+    }
+    bool operator==(const SmallVectorIterator &rhs) const noexcept {
+      return ptr_ == rhs.ptr_;
+    }
+
+    bool operator<(const SmallVectorIterator &rhs) const noexcept {
+      return ptr_ < rhs.ptr_;
+    }
+    bool operator<=(const SmallVectorIterator &rhs) const noexcept {
+      return ptr_ <= rhs.ptr_;
+    }
+    bool operator>(const SmallVectorIterator &rhs) const noexcept {
+      return ptr_ > rhs.ptr_;
+    }
+    bool operator>=(const SmallVectorIterator &rhs) const noexcept {
+      return ptr_ >= rhs.ptr_;
+    }
+
+    SmallVectorIterator operator++(int) noexcept {
+      SmallVectorIterator temp = *this;
+      ++ptr_;
+      return temp;
+    }
+    SmallVectorIterator &operator++() noexcept {
+      ++ptr_;
+      return *this;
+    }
+    SmallVectorIterator operator--(int) noexcept {
+      SmallVectorIterator temp = *this;
+      --ptr_;
+      return temp;
+    }
+    SmallVectorIterator &operator--() noexcept {
+      --ptr_;
+      return *this;
+    }
+
+    pointer GetPtr() const noexcept { return ptr_; }
+
+   private:
+    pointer ptr_ = nullptr;
+  };
+
+ public:
+  using iterator = SmallVectorIterator;
+  using const_iterator = const SmallVectorIterator;
+
+  small_vector() noexcept : data_(InlineData()), size_(0), capacity_(N) {}
+
+  explicit small_vector(size_type n) : small_vector() {
+    reserve(n);
+
+    for (; size_ < n; ++size_) {
+      new (data_ + size_) value_type();
+    }
+  }
+
+  small_vector(std::initializer_list<value_type> const &items)
+      : small_vector() {
+    reserve(items.size());
+
+    for (const auto &item : items) {
+      new (data_ + size_) value_type(item);
+      ++size_;
+    }
+  }
+
+  small_vector(const small_vector &v) : small_vector() {
+    reserve(v.size_);
+
+    for (; size_ < v.size_; ++size_) {
+      new (data_ + size_) value_type(v.data_[size_]);
+    }
+  }
+
+  small_vector(small_vector &&v) noexcept : small_vector() { StealFrom(v); }
+
+  ~small_vector() noexcept {
+    clear();
+    ReleaseHeap();
+  }
+
+  small_vector &operator=(const small_vector &v) {
+    if (this != &v) {
+      small_vector copy(v);
+      clear();
+      ReleaseHeap();
+      StealFrom(copy);
+    }
+
+    return *this;
+  }
+
+  small_vector &operator=(small_vector &&v) noexcept {
+    if (this != &v) {
+      clear();
+      ReleaseHeap();
+      StealFrom(v);
+    }
+
+    return *this;
+  }
+
+  // Element access
+  reference at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("Index out of bounds");
+    }
+
+    return data_[pos];
+  }
+
+  reference operator[](size_type pos) const noexcept { return data_[pos]; }
+
+  const_reference front() const noexcept { return data_[0]; }
+
+  const_reference back() const noexcept { return data_[size_ - 1]; }
+
+  pointer data() const noexcept { return data_; }
+
+  // Iterators
+  iterator begin() const noexcept { return iterator(data_); }
+
+  iterator end() const noexcept { return iterator(data_ + size_); }
+
+  // Capacity
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+  }
+
+  void reserve(size_type size) {
+    if (size <= capacity_) {
+      return;
+    }
+
+    if (size > max_size()) {
+      throw std::length_error("Out of container's limit");
+    }
+
+    Relocate(static_cast<pointer>(::operator new(size * sizeof(value_type))),
+             size);
+  }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+  bool is_inline() const noexcept { return data_ == InlineData(); }
+
+  void shrink_to_fit() {
+    if (is_inline() || size_ == capacity_) {
+      return;
+    }
+
+    if (size_ <= N) {
+      Relocate(InlineData(), N);
+    } else {
+      Relocate(static_cast<pointer>(::operator new(size_ * sizeof(value_type))),
+               size_);
+    }
+  }
+
+  // Modifiers
+  void clear() noexcept {
+    for (size_type i = 0; i < size_; ++i) {
+      data_[i].~value_type();
+    }
+
+    size_ = 0;
+  }
+
+  iterator insert(iterator pos, const_reference value) {
+    size_type index = pos.GetPtr() - data_;
+
+    if (index > size_) {
+      throw std::out_of_range("Index out of bounds");
+    }
+
+    value_type copy(value);
+    GrowIfFull();
+
+    if (index == size_) {
+      new (data_ + size_) value_type(std::move(copy));
+    } else {
+      new (data_ + size_) value_type(std::move(data_[size_ - 1]));
+
+      for (size_type i = size_ - 1; i > index; --i) {
+        data_[i] = std::move(data_[i - 1]);
+      }
+
+      data_[index] = std::move(copy);
+    }
+
+    ++size_;
+    return iterator(data_ + index);
+  }
+
+  void erase(iterator pos) {
+    size_type index = pos.GetPtr() - data_;
+
+    if (index >= size_) {
+      throw std::out_of_range("Index out of bounds");
+    }
+
+    for (size_type i = index; i < size_ - 1; ++i) {
+      data_[i] = std::move(data_[i + 1]);
+    }
+
+    data_[size_ - 1].~value_type();
+
+    --size_;
+  }
+
+  void push_back(const_reference value) {
+    if (size_ < capacity_) {
+      new (data_ + size_) value_type(value);
+    } else {
+      value_type copy(value);
+      GrowIfFull();
+      new (data_ + size_) value_type(std::move(copy));
+    }
+
+    ++size_;
+  }
+
+  void pop_back() noexcept {
+    if (size_ > 0) {
+      data_[size_ - 1].~value_type();
+
+      --size_;
+    }
+  }
+
+  void swap(small_vector &other) noexcept {
+    if (this == &other) {
+      return;
+    }
+
+    if (!is_inline() && !other.is_inline()) {
+      std::swap(data_, other.data_);
+      std::swap(size_, other.size_);
+      std::swap(capacity_, other.capacity_);
+      return;
+    }
+
+    small_vector temp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(temp);
+  }
+
+ private:
+  pointer InlineData() const noexcept {
+    return std::launder(
+        reinterpret_cast<pointer>(const_cast<unsigned char *>(buffer_)));
+  }
+
+  void GrowIfFull() {
+    if (size_ >= capacity_) {
+      reserve(capacity_ * 2);
+    }
+  }
+
+  // Moves the elements into new_data, which the vector then owns. Elements
+  // whose move may throw are copied, and the old ones are destroyed only
+  // once all have been built, so on an exception the vector is unchanged
+  // and a heap new_data is freed.
+  void Relocate(pointer new_data, size_type new_capacity) {
+    size_type built = 0;
+
+    try {
+      for (; built < size_; ++built) {
+        new (new_data + built)
+            value_type(std::move_if_noexcept(data_[built]));
+      }
+    } catch (...) {
+      for (size_type i = 0; i < built; ++i) {
+        new_data[i].~value_type();
+      }
+
+      if (new_data != InlineData()) {
+        ::operator delete(new_data);
+      }
+
+      throw;
+    }
+
+    for (size_type i = 0; i < size_; ++i) {
+      data_[i].~value_type();
+    }
+
+    ReleaseHeap();
+
+    data_ = new_data;
+    capacity_ = new_capacity;
+  }
+
+  void ReleaseHeap() noexcept {
+    if (!is_inline()) {
+      ::operator delete(data_);
+      data_ = InlineData();
+      capacity_ = N;
+    }
+  }
+
+  void StealFrom(small_vector &v) noexcept {
+    if (v.is_inline()) {
+      for (size_type i = 0; i < v.size_; ++i) {
+        new (data_ + i) value_type(std::move(v.data_[i]));
+      }
+
+      size_ = v.size_;
+      v.clear();
+    } else {
+      data_ = v.data_;
+      size_ = v.size_;
+      capacity_ = v.capacity_;
+
+      v.data_ = v.InlineData();
+      v.size_ = 0;
+      v.capacity_ = N;
+    }
+  }
+
+  pointer data_;
+  size_type size_;
+  size_type capacity_;
+  alignas(value_type) unsigned char buffer_[N * sizeof(value_type)];
+};
+}  // namespace s21
+
+#endif  // S21_SMALL_VECTOR_H
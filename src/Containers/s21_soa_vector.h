@@ -0,0 +1,518 @@
+#ifndef S21_SOA_VECTOR_H
+#define S21_SOA_VECTOR_H
+
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "s21_memory.h"
+
+namespace s21 {
+// Non-owning view of a contiguous run of elements.
+template <typename T>
+class span {
+ public:
+  using value_type = std::remove_cv_t<T>;
+  using pointer = T *;
+  using reference = T &;
+  using iterator = T *;
+  using size_type = size_t;
+
+  span() noexcept = default;
+  span(pointer data, size_type size) noexcept : data_(data), size_(size) {}
+
+  reference operator[](size_type pos) const noexcept { return data_[pos]; }
+
+  pointer data() const noexcept { return data_; }
+
+  size_type size() const noexcept { return size_; }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  iterator begin() const noexcept { return data_; }
+
+  iterator end() const noexcept { return data_ + size_; }
+
+ private:
+  pointer data_ = nullptr;
+  size_type size_ = 0;
+};
+
+// Structure-of-arrays sequence: every field of a row lives in its own
+// contiguous column, so a loop touching one field streams only that field
+// through the cache. All columns share a single allocation and a single
+// capacity; each column starts on a 64-byte boundary so column<I>() can be
+// handed straight to SIMD kernels. Rows are accessed through tuples of
+// references.
+template <typename... Ts>
+class soa_vector {
+  static_assert(sizeof...(Ts) > 0, "soa_vector needs at least one column");
+
+ public:
+  using value_type = std::tuple<Ts...>;
+  using reference = std::tuple<Ts &...>;
+  using const_reference = std::tuple<const Ts &...>;
+  using size_type = size_t;
+
+  template <size_t I>
+  using column_type = std::tuple_element_t<I, value_type>;
+
+  static constexpr size_type kColumns = sizeof...(Ts);
+  static constexpr size_type kColumnAlignment = 64;
+
+ private:
+  class SoaIterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::tuple<Ts...>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = std::tuple<Ts &...>;
+
+    SoaIterator() = default;
+    SoaIterator(const soa_vector *owner, size_type index)
+        : owner_(owner), index_(index) {}
+
+    reference operator*() const noexcept { return (*owner_)[index_]; }
+
+    bool operator!=(const SoaIterator &rhs) const noexcept {
+      return index_ != rhs.index_;
+    }
+    bool operator==(const SoaIterator &rhs) const noexcept {
+      return index_ == rhs.index_;
+    }
+
+    bool operator<(const SoaIterator &rhs) const noexcept {
+      return index_ < rhs.index_;
+    }
+    bool operator<=(const SoaIterator &rhs) const noexcept {
+      return index_ <= rhs.index_;
+    }
+    bool operator>(const SoaIterator &rhs) const noexcept {
+      return index_ > rhs.index_;
+    }
+    bool operator>=(const SoaIterator &rhs) const noexcept {
+      return index_ >= rhs.index_;
+    }
+
+    SoaIterator operator++(int) noexcept {
+      SoaIterator temp = *this;
+      ++index_;
+      return temp;
+    }
+    SoaIterator &operator++() noexcept {
+      ++index_;
+      return *this;
+    }
+    SoaIterator operator--(int) noexcept {
+      SoaIterator temp = *this;
+      --index_;
+      return temp;
+    }
+    SoaIterator &operator--() noexcept {
+      --index_;
+      return *this;
+    }
+
+    SoaIterator &operator+=(difference_type n) noexcept {
+      index_ += n;
+      return *this;
+    }
+    SoaIterator &operator-=(difference_type n) noexcept {
+      index_ -= n;
+      return *this;
+    }
+    SoaIterator operator+(difference_type n) const noexcept {
+      return SoaIterator(owner_, index_ + n);
+    }
+    SoaIterator operator-(difference_type n) const noexcept {
+      return SoaIterator(owner_, index_ - n);
+    }
+    difference_type operator-(const SoaIterator &rhs) const noexcept {
+      return static_cast<difference_type>(index_ - rhs.index_);
+    }
+    reference operator[](difference_type n) const noexcept {
+      return (*owner_)[index_ + n];
+    }
+
+    size_type GetIndex() const noexcept { return index_; }
+
+   private:
+    const soa_vector *owner_ = nullptr;
+    size_type index_ = 0;
+  };
+
+  using Columns = std::tuple<Ts *...>;
+  using Indices = std::index_sequence_for<Ts...>;
+
+ public:
+  using iterator = SoaIterator;
+  using const_iterator = const SoaIterator;
+
+  soa_vector() noexcept : block_(nullptr), size_(0), capacity_(0) {}
+
+  explicit soa_vector(size_type n) : soa_vector() {
+    try {
+      resize(n);
+    } catch (...) {
+      Deallocate();
+      throw;
+    }
+  }
+
+  soa_vector(std::initializer_list<value_type> const &rows) : soa_vector() {
+    try {
+      reserve(rows.size());
+      for (const auto &row : rows) {
+        push_back(row);
+      }
+    } catch (...) {
+      Deallocate();
+      throw;
+    }
+  }
+
+  soa_vector(const soa_vector &v) : soa_vector() {
+    try {
+      CopyFrom(v);
+    } catch (...) {
+      Deallocate();
+      throw;
+    }
+  }
+
+  soa_vector(soa_vector &&v) noexcept
+      : columns_(v.columns_),
+        block_(v.block_),
+        size_(v.size_),
+        capacity_(v.capacity_) {
+    v.columns_ = Columns();
+    v.block_ = nullptr;
+    v.size_ = v.capacity_ = 0;
+  }
+
+  ~soa_vector() noexcept { Deallocate(); }
+
+  soa_vector &operator=(const soa_vector &v) {
+    if (this != &v) {
+      clear();
+      CopyFrom(v);
+    }
+
+    return *this;
+  }
+
+  soa_vector &operator=(soa_vector &&v) noexcept {
+    if (this != &v) {
+      Deallocate();
+      swap(v);
+    }
+
+    return *this;
+  }
+
+  // Element access
+  reference at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("Index out of bounds");
+    }
+
+    return (*this)[pos];
+  }
+
+  reference operator[](size_type pos) const noexcept {
+    return RowAt(pos, Indices());
+  }
+
+  reference front() const noexcept { return (*this)[0]; }
+
+  reference back() const noexcept { return (*this)[size_ - 1]; }
+
+  template <size_t I>
+  column_type<I> *data() const noexcept {
+    return std::get<I>(columns_);
+  }
+
+  // Contiguous view of one field across all rows.
+  template <size_t I>
+  span<column_type<I>> column() const noexcept {
+    return span<column_type<I>>(data<I>(), size_);
+  }
+
+  // Iterators
+  iterator begin() const noexcept { return iterator(this, 0); }
+
+  iterator end() const noexcept { return iterator(this, size_); }
+
+  // Capacity
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / RowBytes() / 2;
+  }
+
+  void reserve(size_type size) {
+    if (size <= capacity_) {
+      return;
+    }
+
+    if (size > max_size()) {
+      throw std::length_error("Out of container's limit");
+    }
+
+    Reallocate(size);
+  }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+  void shrink_to_fit() {
+    if (size_ != capacity_) {
+      Reallocate(size_);
+    }
+  }
+
+  // Modifiers
+  void clear() noexcept {
+    ForEachColumn([&](auto column) {
+      auto *data = std::get<decltype(column)::value>(columns_);
+      for (size_type i = 0; i < size_; ++i) {
+        Destroy(data + i);
+      }
+    });
+
+    size_ = 0;
+  }
+
+  // Appends one row. Every column grows together, so there is a single
+  // capacity check per row.
+  void push_back(const Ts &...values) {
+    if (size_ < capacity_) {
+      ConstructRow(size_, Indices(), values...);
+    } else {
+      value_type copy(values...);
+      GrowIfFull();
+      std::apply(
+          [&](Ts &...fields) {
+            ConstructRow(size_, Indices(), std::move(fields)...);
+          },
+          copy);
+    }
+
+    ++size_;
+  }
+
+  void push_back(const value_type &row) {
+    std::apply([&](const Ts &...fields) { push_back(fields...); }, row);
+  }
+
+  void pop_back() noexcept {
+    if (size_ > 0) {
+      --size_;
+      ForEachColumn([&](auto column) {
+        Destroy(std::get<decltype(column)::value>(columns_) + size_);
+      });
+    }
+  }
+
+  // Grows with value-initialized rows or destroys trailing rows.
+  void resize(size_type size) {
+    if (size < size_) {
+      while (size_ > size) {
+        pop_back();
+      }
+      return;
+    }
+
+    reserve(size);
+    for (; size_ < size; ++size_) {
+      ConstructRow(size_, Indices(), Ts()...);
+    }
+  }
+
+  void swap(soa_vector &other) noexcept {
+    std::swap(columns_, other.columns_);
+    std::swap(block_, other.block_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+  }
+
+ private:
+  static constexpr std::array<size_type, kColumns> kValueSizes = {
+      sizeof(Ts)...};
+
+  static constexpr size_type RowBytes() noexcept {
+    size_type bytes = 0;
+    for (size_type value_size : kValueSizes) {
+      bytes += value_size;
+    }
+    return bytes;
+  }
+
+  static size_type AlignUp(size_type bytes) noexcept {
+    return (bytes + kColumnAlignment - 1) / kColumnAlignment *
+           kColumnAlignment;
+  }
+
+  // Byte offset of each column inside a block for capacity rows; the last
+  // entry is the size of the whole block.
+  static std::array<size_type, kColumns + 1> Layout(size_type capacity) {
+    std::array<size_type, kColumns + 1> offsets{};
+    for (size_type i = 0; i < kColumns; ++i) {
+      offsets[i + 1] = AlignUp(offsets[i] + capacity * kValueSizes[i]);
+    }
+    return offsets;
+  }
+
+  template <typename F>
+  static void ForEachColumn(F &&f) {
+    ForEachColumn(f, Indices());
+  }
+
+  template <typename F, size_t... I>
+  static void ForEachColumn(F &f, std::index_sequence<I...>) {
+    (f(std::integral_constant<size_t, I>()), ...);
+  }
+
+  template <typename U>
+  static void Destroy(U *p) noexcept {
+    p->~U();
+  }
+
+  template <size_t... I>
+  reference RowAt(size_type pos, std::index_sequence<I...>) const noexcept {
+    return reference(std::get<I>(columns_)[pos]...);
+  }
+
+  // Constructs the fields of row pos one column at a time, destroying the
+  // fields already built if a later one throws.
+  template <size_t... I, typename... Args>
+  void ConstructRow(size_type pos, std::index_sequence<I...>,
+                    Args &&...args) {
+    size_type built = 0;
+
+    try {
+      ((::new (static_cast<void *>(std::get<I>(columns_) + pos))
+            Ts(std::forward<Args>(args)),
+        ++built),
+       ...);
+    } catch (...) {
+      ((I < built ? Destroy(std::get<I>(columns_) + pos) : void()), ...);
+      throw;
+    }
+  }
+
+  void GrowIfFull() {
+    if (size_ >= capacity_) {
+      size_type new_capacity =
+          doubling_growth::next_capacity(capacity_, size_ + 1, RowBytes());
+      reserve(new_capacity < max_size() ? new_capacity : max_size());
+    }
+  }
+
+  void CopyFrom(const soa_vector &v) {
+    reserve(v.size_);
+
+    for (; size_ < v.size_; ++size_) {
+      std::apply(
+          [&](const Ts &...fields) {
+            ConstructRow(size_, Indices(), fields...);
+          },
+          v[size_]);
+    }
+  }
+
+  // Moves every column into a new block laid out for new_capacity rows.
+  // Columns whose fields may throw while being copied or moved are built
+  // first and the nothrow ones last, so nothing old is moved from or
+  // destroyed until every throwing step has succeeded. If one throws, the
+  // fields built so far are destroyed, the new block is freed and the
+  // vector is left as it was.
+  void Reallocate(size_type new_capacity) {
+    std::array<size_type, kColumns + 1> offsets = Layout(new_capacity);
+    char *block = nullptr;
+    Columns columns;
+    std::array<size_type, kColumns> built = {};
+
+    if (new_capacity > 0) {
+      block = static_cast<char *>(::operator new(
+          offsets[kColumns], std::align_val_t(kColumnAlignment)));
+    }
+
+    auto build = [&](auto column, auto nothrow) {
+      constexpr size_t I = decltype(column)::value;
+      using U = column_type<I>;
+
+      if constexpr (std::is_nothrow_move_constructible<U>::value ==
+                    decltype(nothrow)::value) {
+        U *from = std::get<I>(columns_);
+        U *to = block ? reinterpret_cast<U *>(block + offsets[I]) : nullptr;
+        for (size_type &i = built[I]; i < size_; ++i) {
+          ::new (static_cast<void *>(to + i)) U(std::move_if_noexcept(from[i]));
+        }
+
+        std::get<I>(columns) = to;
+      }
+    };
+
+    try {
+      ForEachColumn([&](auto column) { build(column, std::false_type()); });
+    } catch (...) {
+      ForEachColumn([&](auto column) {
+        constexpr size_t I = decltype(column)::value;
+        using U = column_type<I>;
+
+        for (size_type i = 0; i < built[I]; ++i) {
+          Destroy(reinterpret_cast<U *>(block + offsets[I]) + i);
+        }
+      });
+
+      ::operator delete(block, std::align_val_t(kColumnAlignment));
+      throw;
+    }
+
+    ForEachColumn([&](auto column) { build(column, std::true_type()); });
+    ForEachColumn([&](auto column) {
+      constexpr size_t I = decltype(column)::value;
+
+      for (size_type i = 0; i < size_; ++i) {
+        Destroy(std::get<I>(columns_) + i);
+      }
+    });
+
+    FreeBlock();
+    columns_ = columns;
+    block_ = block;
+    capacity_ = new_capacity;
+  }
+
+  void FreeBlock() noexcept {
+    if (block_) {
+      ::operator delete(block_, std::align_val_t(kColumnAlignment));
+      block_ = nullptr;
+    }
+  }
+
+  void Deallocate() noexcept {
+    clear();
+    FreeBlock();
+    columns_ = Columns();
+    capacity_ = 0;
+  }
+
+  Columns columns_;
+  char *block_;
+  size_type size_;
+  size_type capacity_;
+};
+}  // namespace s21
+
+#endif  // S21_SOA_VECTOR_H
@@ -0,0 +1,701 @@
+#ifndef S21_UNROLLED_LIST_H
+#define S21_UNROLLED_LIST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+// Linked list of chunks, each holding up to chunk_capacity() elements
+// contiguously in a few cache lines, with the interface of s21::list apart
+// from compact(), which chunks make unnecessary. Scans touch one chunk
+// header per chunk instead of one node per element. Insertion into a full
+// chunk splits it in half; an erase that leaves a chunk at most half full
+// together with its successor merges the two. Inserting or erasing
+// invalidates iterators into the affected chunks. Elements are shifted
+// within and between chunks, so T must be nothrow movable.
+template <typename T, typename Allocator = std::allocator<T>>
+class unrolled_list {
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+
+ private:
+  static constexpr size_type kCacheLine = 64;
+  static constexpr size_type kChunkBytes = 4 * kCacheLine;
+
+  struct ChunkBase {
+    ChunkBase *next;
+    ChunkBase *prev;
+    size_type count;
+  };
+
+  static constexpr size_type kFit =
+      (kChunkBytes - sizeof(ChunkBase)) / sizeof(value_type);
+  static constexpr size_type kCapacity = kFit < 8 ? 8 : kFit;
+
+  struct alignas(kCacheLine) Chunk : ChunkBase {
+    Chunk() noexcept : ChunkBase{nullptr, nullptr, 0} {}
+
+    alignas(value_type) unsigned char storage[kCapacity * sizeof(value_type)];
+  };
+
+  using chunk_allocator_type = typename std::allocator_traits<
+      allocator_type>::template rebind_alloc<Chunk>;
+  using chunk_traits = std::allocator_traits<chunk_allocator_type>;
+
+  static_assert(std::is_nothrow_move_constructible<value_type>::value &&
+                    std::is_nothrow_move_assignable<value_type>::value,
+                "elements are moved by noexcept members such as pop_back");
+
+  class UnrolledListIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+
+    explicit UnrolledListIterator(ChunkBase *chunk = nullptr,
+                                  size_type index = 0)
+        : chunk_(chunk), index_(index) {}
+
+    reference operator*() const noexcept { return Items(chunk_)[index_]; }
+    value_type *operator->() const noexcept { return &**this; }
+
+    bool operator!=(const UnrolledListIterator &rhs) const noexcept {
+      return !(*this == rhs);
+    }
+    bool operator==(const UnrolledListIterator &rhs) const noexcept {
+      return chunk_ == rhs.chunk_ && index_ == rhs.index_;
+    }
+
+    UnrolledListIterator operator++(int) noexcept {
+      UnrolledListIterator temp = *this;
+      ++*this;
+      return temp;
+    }
+    UnrolledListIterator &operator++() noexcept {
+      if (++index_ == chunk_->count) {
+        chunk_ = chunk_->next;
+        index_ = 0;
+      }
+      return *this;
+    }
+
+    UnrolledListIterator operator--(int) noexcept {
+      UnrolledListIterator temp = *this;
+      --*this;
+      return temp;
+    }
+    UnrolledListIterator &operator--() noexcept {
+      if (index_ == 0) {
+        chunk_ = chunk_->prev;
+        index_ = chunk_->count;
+      }
+      --index_;
+      return *this;
+    }
+
+    ChunkBase *GetChunk() const noexcept { return chunk_; }
+    size_type GetIndex() const noexcept { return index_; }
+
+   private:
+    ChunkBase *chunk_ = nullptr;
+    size_type index_ = 0;
+  };
+
+ public:
+  using iterator = UnrolledListIterator;
+  using const_iterator = const UnrolledListIterator;
+
+  unrolled_list() noexcept : size_(0) {}
+
+  explicit unrolled_list(const allocator_type &alloc) noexcept
+      : alloc_(alloc), size_(0) {}
+
+  explicit unrolled_list(size_type n,
+                         const allocator_type &alloc = allocator_type())
+      : alloc_(alloc), size_(0) {
+    if (n >= max_size()) {
+      throw std::out_of_range("Out of container's limit");
+    }
+
+    for (size_type i = 0; i < n; ++i) {
+      Emplace(end());
+    }
+  }
+
+  unrolled_list(const std::initializer_list<value_type> &items,
+                const allocator_type &alloc = allocator_type())
+      : alloc_(alloc), size_(0) {
+    for (const T &item : items) {
+      push_back(item);
+    }
+  }
+
+  unrolled_list(const unrolled_list &l)
+      : alloc_(chunk_traits::select_on_container_copy_construction(l.alloc_)),
+        size_(0) {
+    CopyFrom(l);
+  }
+
+  unrolled_list(unrolled_list &&l) noexcept
+      : alloc_(std::move(l.alloc_)), size_(0) {
+    SwapChunks(l);
+  }
+
+  ~unrolled_list() noexcept { clear(); }
+
+  unrolled_list &operator=(const unrolled_list &l) {
+    if (this != &l) {
+      clear();
+
+      if (chunk_traits::propagate_on_container_copy_assignment::value) {
+        alloc_ = l.alloc_;
+      }
+
+      CopyFrom(l);
+    }
+
+    return *this;
+  }
+
+  unrolled_list &operator=(unrolled_list &&l) noexcept(
+      chunk_traits::propagate_on_container_move_assignment::value ||
+      chunk_traits::is_always_equal::value) {
+    if (this != &l) {
+      clear();
+
+      if (chunk_traits::propagate_on_container_move_assignment::value ||
+          alloc_ == l.alloc_) {
+        if (chunk_traits::propagate_on_container_move_assignment::value) {
+          alloc_ = std::move(l.alloc_);
+        }
+
+        SwapChunks(l);
+      } else {
+        for (iterator it = l.begin(); it != l.end(); ++it) {
+          Emplace(end(), std::move(*it));
+        }
+
+        l.clear();
+      }
+    }
+
+    return *this;
+  }
+
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(alloc_);
+  }
+
+  // Number of elements that fit into one chunk.
+  static constexpr size_type chunk_capacity() noexcept { return kCapacity; }
+
+  // Element access
+  const_reference front() const noexcept { return Items(sentinel_.next)[0]; }
+
+  const_reference back() const noexcept {
+    return Items(sentinel_.prev)[sentinel_.prev->count - 1];
+  }
+
+  // Iterators
+  iterator begin() const noexcept { return iterator(sentinel_.next, 0); }
+
+  iterator end() const noexcept {
+    return iterator(const_cast<ChunkBase *>(&sentinel_), 0);
+  }
+
+  // Capacity
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept {
+    return (std::numeric_limits<size_type>::max() / sizeof(value_type)) / 2;
+  }
+
+  // Modifiers
+  void clear() noexcept { Truncate(begin()); }
+
+  iterator insert(iterator pos, const_reference value) {
+    return Emplace(pos, value);
+  }
+
+  iterator insert(iterator pos, value_type &&value) {
+    return Emplace(pos, std::move(value));
+  }
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    return Emplace(pos, std::forward<Args>(args)...);
+  }
+
+  void erase(iterator pos) {
+    if (pos == end()) {
+      throw std::invalid_argument("End or empty");
+    }
+
+    EraseAt(pos.GetChunk(), pos.GetIndex());
+  }
+
+  void push_back(const_reference value) { Emplace(end(), value); }
+
+  void push_back(value_type &&value) { Emplace(end(), std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    return *Emplace(end(), std::forward<Args>(args)...);
+  }
+
+  void pop_back() noexcept {
+    if (!empty()) {
+      EraseAt(sentinel_.prev, sentinel_.prev->count - 1);
+    }
+  }
+
+  void push_front(const_reference value) { Emplace(begin(), value); }
+
+  void push_front(value_type &&value) { Emplace(begin(), std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_front(Args &&...args) {
+    return *Emplace(begin(), std::forward<Args>(args)...);
+  }
+
+  void pop_front() noexcept {
+    if (!empty()) {
+      EraseAt(sentinel_.next, 0);
+    }
+  }
+
+  void swap(unrolled_list &other) noexcept {
+    if (chunk_traits::propagate_on_container_swap::value) {
+      std::swap(alloc_, other.alloc_);
+    }
+
+    SwapChunks(other);
+  }
+
+  // Operations
+  void merge(unrolled_list &other) { merge(other, std::less<>()); }
+
+  // Merges the sorted other into this sorted list; on ties elements of this
+  // list come first. Elements are moved into freshly packed chunks.
+  template <typename Compare>
+  void merge(unrolled_list &other, Compare comp) {
+    if (this == &other || other.empty()) {
+      return;
+    }
+
+    unrolled_list merged(get_allocator());
+    iterator left = begin();
+    iterator right = other.begin();
+
+    while (left != end() && right != other.end()) {
+      if (comp(*right, *left)) {
+        merged.Emplace(merged.end(), std::move(*right++));
+      } else {
+        merged.Emplace(merged.end(), std::move(*left++));
+      }
+    }
+
+    for (; left != end(); ++left) {
+      merged.Emplace(merged.end(), std::move(*left));
+    }
+    for (; right != other.end(); ++right) {
+      merged.Emplace(merged.end(), std::move(*right));
+    }
+
+    SwapChunks(merged);
+    other.clear();
+  }
+
+  // Moves all chunks of other in front of pos. The chunk holding pos is
+  // split first unless pos is the start of a chunk, so at most one chunk
+  // worth of elements is moved.
+  void splice(const_iterator pos, unrolled_list &other) {
+    if (this == &other || other.empty()) {
+      return;
+    }
+
+    ChunkBase *target = pos.GetChunk();
+    if (pos.GetIndex() != 0) {
+      target = SplitAt(target, pos.GetIndex());
+    }
+
+    ChunkBase *first = other.sentinel_.next;
+    ChunkBase *last = other.sentinel_.prev;
+
+    first->prev = target->prev;
+    last->next = target;
+    target->prev->next = first;
+    target->prev = last;
+
+    size_ += other.size_;
+    other.Reset();
+  }
+
+  void splice(const_iterator pos, unrolled_list &other, const_iterator it) {
+    splice(pos, other, it, std::next(it));
+  }
+
+  // Moves the elements of [first, last) from other in front of pos. Unlike
+  // whole lists they are moved element by element; within one list the
+  // range is rotated into place.
+  void splice(const_iterator pos, unrolled_list &other, const_iterator first,
+              const_iterator last) {
+    if (this == &other) {
+      if (NotAfter(last, pos)) {
+        std::rotate(first, last, pos);
+      } else {
+        std::rotate(pos, first, last);
+      }
+      return;
+    }
+
+    iterator at = pos;
+    for (iterator it = first; it != last; ++it) {
+      at = std::next(Emplace(at, std::move(*it)));
+    }
+
+    other.EraseRange(first, last);
+  }
+
+  void reverse() noexcept {
+    for (ChunkBase *current = sentinel_.next; current != &sentinel_;) {
+      std::reverse(Items(current), Items(current) + current->count);
+      std::swap(current->next, current->prev);
+      current = current->prev;
+    }
+
+    std::swap(sentinel_.next, sentinel_.prev);
+  }
+
+  // Survivors are moved down over the removed elements in one pass and the
+  // tail is cut off. value is copied first, so it may refer to an element.
+  // Returns the number removed.
+  size_type remove(const_reference value) {
+    value_type copy(value);
+    return remove_if(
+        [&copy](const_reference element) { return element == copy; });
+  }
+
+  template <typename UnaryPredicate>
+  size_type remove_if(UnaryPredicate pred) {
+    size_type old_size = size_;
+    iterator kept = begin();
+
+    for (iterator it = begin(); it != end(); ++it) {
+      if (!pred(*it)) {
+        if (kept != it) {
+          *kept = std::move(*it);
+        }
+        ++kept;
+      }
+    }
+
+    Truncate(kept);
+    return old_size - size_;
+  }
+
+  size_type unique() { return unique(std::equal_to<>()); }
+
+  // Removes every element for which pred(kept, element) holds, where kept
+  // is the last element left in place. Returns the number removed.
+  template <typename BinaryPredicate>
+  size_type unique(BinaryPredicate pred) {
+    if (size_ <= 1) {
+      return 0;
+    }
+
+    size_type old_size = size_;
+    iterator kept = begin();
+    for (iterator it = std::next(kept); it != end(); ++it) {
+      if (!pred(*kept, *it)) {
+        ++kept;
+        if (kept != it) {
+          *kept = std::move(*it);
+        }
+      }
+    }
+
+    Truncate(++kept);
+    return old_size - size_;
+  }
+
+  void sort() { sort(std::less<>()); }
+
+  // Stable sort. The elements are moved into one contiguous buffer, sorted
+  // there and moved back into the same chunks.
+  template <typename Compare>
+  void sort(Compare comp) {
+    if (size_ <= 1) {
+      return;
+    }
+
+    std::vector<value_type> buffer;
+    buffer.reserve(size_);
+    for (iterator it = begin(); it != end(); ++it) {
+      buffer.push_back(std::move(*it));
+    }
+
+    std::stable_sort(buffer.begin(), buffer.end(), comp);
+    std::move(buffer.begin(), buffer.end(), begin());
+  }
+
+ private:
+  static value_type *Items(ChunkBase *chunk) noexcept {
+    return std::launder(reinterpret_cast<value_type *>(
+        static_cast<Chunk *>(chunk)->storage));
+  }
+
+  // Constructs the new element first, so that arguments referring to
+  // elements of this list stay valid while chunks are reorganized, then
+  // finds it a slot: the end of the previous chunk when inserting at the
+  // start of a chunk, a new chunk when that one is full too, and otherwise
+  // the chunk of pos, split in half when it is full.
+  template <typename... Args>
+  iterator Emplace(iterator pos, Args &&...args) {
+    value_type value(std::forward<Args>(args)...);
+    ChunkBase *chunk = pos.GetChunk();
+    size_type index = pos.GetIndex();
+
+    if (index == 0 && chunk->prev != &sentinel_ &&
+        chunk->prev->count < kCapacity) {
+      chunk = chunk->prev;
+      index = chunk->count;
+    } else if (chunk == &sentinel_ ||
+               (index == 0 && chunk->count == kCapacity)) {
+      chunk = LinkChunkBefore(chunk);
+    } else if (chunk->count == kCapacity) {
+      ChunkBase *upper = SplitAt(chunk, kCapacity / 2);
+      if (index > kCapacity / 2) {
+        chunk = upper;
+        index -= kCapacity / 2;
+      }
+    }
+
+    value_type *items = Items(chunk);
+    size_type count = chunk->count;
+
+    if (index == count) {
+      new (items + count) value_type(std::move(value));
+    } else {
+      new (items + count) value_type(std::move(items[count - 1]));
+      std::move_backward(items + index, items + count - 1, items + count);
+      items[index] = std::move(value);
+    }
+
+    ++chunk->count;
+    ++size_;
+    return iterator(chunk, index);
+  }
+
+  void EraseAt(ChunkBase *chunk, size_type index) noexcept {
+    EraseItems(chunk, index, index + 1);
+    Consolidate(chunk);
+  }
+
+  // Destroys the elements of [first, last), which may span chunks, and
+  // frees the chunks emptied.
+  void EraseRange(iterator first, iterator last) noexcept {
+    ChunkBase *chunk = first.GetChunk();
+    ChunkBase *stop = last.GetChunk();
+
+    if (first == last) {
+      return;
+    } else if (chunk == stop) {
+      EraseItems(chunk, first.GetIndex(), last.GetIndex());
+    } else {
+      EraseItems(chunk, first.GetIndex(), chunk->count);
+
+      for (ChunkBase *middle = chunk->next; middle != stop;) {
+        ChunkBase *next = middle->next;
+        EraseItems(middle, 0, middle->count);
+        UnlinkChunk(middle);
+        middle = next;
+      }
+
+      if (stop != &sentinel_) {
+        EraseItems(stop, 0, last.GetIndex());
+      }
+    }
+
+    Consolidate(chunk);
+  }
+
+  // Moves the elements behind [first, last) of chunk down over it and
+  // destroys the vacated slots.
+  void EraseItems(ChunkBase *chunk, size_type first, size_type last) noexcept {
+    value_type *items = Items(chunk);
+    size_type count = chunk->count;
+
+    std::move(items + last, items + count, items + first);
+    std::destroy(items + count - (last - first), items + count);
+    chunk->count -= last - first;
+    size_ -= last - first;
+  }
+
+  // Frees chunk once empty, or merges its successor into it when both fit
+  // into half a chunk.
+  void Consolidate(ChunkBase *chunk) noexcept {
+    if (chunk->count == 0) {
+      UnlinkChunk(chunk);
+    } else if (chunk->next != &sentinel_ &&
+               chunk->count + chunk->next->count <= kCapacity / 2) {
+      ChunkBase *next = chunk->next;
+      MoveItems(next, 0, next->count, chunk, chunk->count);
+      chunk->count += next->count;
+      next->count = 0;
+      UnlinkChunk(next);
+    }
+  }
+
+  // Destroys every element from pos to the end and frees emptied chunks.
+  void Truncate(iterator pos) noexcept {
+    ChunkBase *chunk = pos.GetChunk();
+    if (chunk == &sentinel_) {
+      return;
+    }
+
+    value_type *items = Items(chunk);
+    std::destroy(items + pos.GetIndex(), items + chunk->count);
+    size_ -= chunk->count - pos.GetIndex();
+    chunk->count = pos.GetIndex();
+
+    ChunkBase *last = chunk;
+    if (chunk->count == 0) {
+      last = chunk->prev;
+    } else {
+      chunk = chunk->next;
+    }
+
+    while (chunk != &sentinel_) {
+      ChunkBase *next = chunk->next;
+      std::destroy(Items(chunk), Items(chunk) + chunk->count);
+      size_ -= chunk->count;
+      FreeChunk(chunk);
+      chunk = next;
+    }
+
+    last->next = &sentinel_;
+    sentinel_.prev = last;
+  }
+
+  // Moves the elements from index on into a new chunk linked after chunk
+  // and returns the new chunk.
+  ChunkBase *SplitAt(ChunkBase *chunk, size_type index) {
+    ChunkBase *upper = LinkChunkBefore(chunk->next);
+
+    MoveItems(chunk, index, chunk->count, upper, 0);
+    upper->count = chunk->count - index;
+    chunk->count = index;
+
+    return upper;
+  }
+
+  // Move-constructs from[first, last) into the raw slots of to starting at
+  // at and destroys the originals. Counts are left to the caller; T being
+  // nothrow movable is asserted above.
+  static void MoveItems(ChunkBase *from, size_type first, size_type last,
+                        ChunkBase *to, size_type at) noexcept {
+    value_type *source = Items(from);
+    value_type *target = Items(to) + at;
+
+    for (size_type i = first; i < last; ++i, ++target) {
+      new (target) value_type(std::move(source[i]));
+      source[i].~value_type();
+    }
+  }
+
+  ChunkBase *LinkChunkBefore(ChunkBase *pos) {
+    Chunk *chunk = chunk_traits::allocate(alloc_, 1);
+    chunk_traits::construct(alloc_, chunk);
+
+    chunk->prev = pos->prev;
+    chunk->next = pos;
+    pos->prev->next = chunk;
+    pos->prev = chunk;
+
+    return chunk;
+  }
+
+  void UnlinkChunk(ChunkBase *chunk) noexcept {
+    chunk->prev->next = chunk->next;
+    chunk->next->prev = chunk->prev;
+    FreeChunk(chunk);
+  }
+
+  void FreeChunk(ChunkBase *base) noexcept {
+    Chunk *chunk = static_cast<Chunk *>(base);
+    chunk_traits::destroy(alloc_, chunk);
+    chunk_traits::deallocate(alloc_, chunk, 1);
+  }
+
+  // True if a is b or comes before it. Walks chunks, not elements.
+  bool NotAfter(iterator a, iterator b) const noexcept {
+    if (a.GetChunk() == b.GetChunk()) {
+      return a.GetIndex() <= b.GetIndex();
+    }
+
+    for (ChunkBase *chunk = a.GetChunk(); chunk != &sentinel_;
+         chunk = chunk->next) {
+      if (chunk == b.GetChunk()) {
+        return true;
+      }
+    }
+
+    return b.GetChunk() == &sentinel_;
+  }
+
+  void Reset() noexcept {
+    sentinel_.next = sentinel_.prev = &sentinel_;
+    size_ = 0;
+  }
+
+  void SwapChunks(unrolled_list &other) noexcept {
+    std::swap(sentinel_.next, other.sentinel_.next);
+    std::swap(sentinel_.prev, other.sentinel_.prev);
+    std::swap(size_, other.size_);
+
+    RepointEnds();
+    other.RepointEnds();
+  }
+
+  void RepointEnds() noexcept {
+    if (size_ == 0) {
+      Reset();
+    } else {
+      sentinel_.next->prev = &sentinel_;
+      sentinel_.prev->next = &sentinel_;
+    }
+  }
+
+  void CopyFrom(const unrolled_list &l) {
+    for (iterator it = l.begin(); it != l.end(); ++it) {
+      push_back(*it);
+    }
+  }
+
+  chunk_allocator_type alloc_;
+  ChunkBase sentinel_{&sentinel_, &sentinel_, 0};
+
+  size_type size_;
+};
+}  // namespace s21
+
+#endif  // S21_UNROLLED_LIST_H
@@ -1,24 +1,54 @@
 #ifndef S21_VECTOR_H
 #define S21_VECTOR_H
 
+#include <algorithm>
+#include <cstddef>
 #include <initializer_list>
+#include <iterator>
 #include <limits>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#include "s21_memory.h"
+
 namespace s21 {
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>,
+          typename GrowthPolicy = doubling_growth>
 class vector {
  public:
   using value_type = T;
+  using allocator_type = Allocator;
+  using growth_policy = GrowthPolicy;
   using reference = T &;
   using pointer = T *;
   using const_reference = const value_type &;
   using size_type = size_t;
+  // Frees a buffer handed to adopt(); receives the buffer and its capacity.
+  using deleter_type = void (*)(pointer, size_type);
 
  private:
+  using alloc_traits = std::allocator_traits<allocator_type>;
+
+  static_assert(std::is_same<typename alloc_traits::value_type, T>::value,
+                "Allocator::value_type must be T");
+  static_assert(std::is_same<typename alloc_traits::pointer, pointer>::value,
+                "Allocator must hand out raw pointers");
+
+  static constexpr bool kCanReallocate =
+      has_reallocate<allocator_type>::value &&
+      std::is_trivially_copyable<value_type>::value;
+
   class VectorIterator {
    public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+
+    VectorIterator() = default;
     explicit VectorIterator(pointer ptr) : ptr_(ptr) {}
 
     reference operator*() const noexcept { return *ptr_; }
@@ -63,6 +93,27 @@ class vector {
       return *this;
     }
 
+    VectorIterator &operator+=(difference_type n) noexcept {
+      ptr_ += n;
+      return *this;
+    }
+    VectorIterator &operator-=(difference_type n) noexcept {
+      ptr_ -= n;
+      return *this;
+    }
+    VectorIterator operator+(difference_type n) const noexcept {
+      return VectorIterator(ptr_ + n);
+    }
+    VectorIterator operator-(difference_type n) const noexcept {
+      return VectorIterator(ptr_ - n);
+    }
+    difference_type operator-(const VectorIterator &rhs) const noexcept {
+      return ptr_ - rhs.ptr_;
+    }
+    reference operator[](difference_type n) const noexcept { return ptr_[n]; }
+
+    pointer GetPtr() const noexcept { return ptr_; }
+
    private:
     pointer ptr_ = nullptr;
   };
@@ -71,65 +122,124 @@ class vector {
   using iterator = VectorIterator;
   using const_iterator = const VectorIterator;
 
-  vector() : data_(nullptr), size_(0), capacity_(0){};
-
-  explicit vector(size_type n) : size_(n), capacity_(n) {
-    data_ = new value_type[capacity_];
-
-    for (size_type i = 0; i < size_; ++i) {
-      new (&data_[i]) value_type();
+  vector() noexcept(noexcept(allocator_type()))
+      : alloc_(),
+        data_(nullptr),
+        size_(0),
+        capacity_(0),
+        deleter_(nullptr){};
+
+  explicit vector(const allocator_type &alloc) noexcept
+      : alloc_(alloc),
+        data_(nullptr),
+        size_(0),
+        capacity_(0),
+        deleter_(nullptr) {}
+
+  explicit vector(size_type n, const allocator_type &alloc = allocator_type())
+      : vector(alloc) {
+    Reallocate(n);
+
+    for (; size_ < n; ++size_) {
+      alloc_traits::construct(alloc_, data_ + size_);
     }
   };
 
-  vector(std::initializer_list<value_type> const &items)
-      : size_(items.size()), capacity_(items.size()) {
-    data_ = new value_type[capacity_];
+  vector(std::initializer_list<value_type> const &items,
+         const allocator_type &alloc = allocator_type())
+      : vector(alloc) {
+    Reallocate(items.size());
 
-    size_type i = 0;
     for (const auto &item : items) {
-      new (&data_[i++]) value_type(item);
+      alloc_traits::construct(alloc_, data_ + size_, item);
+      ++size_;
     }
   }
 
-  vector(const vector &v) : size_(v.size_), capacity_(v.size_) {
-    data_ = new value_type[capacity_];
+  vector(const vector &v)
+      : vector(alloc_traits::select_on_container_copy_construction(v.alloc_)) {
+    CopyFrom(v);
+  }
 
-    for (size_type i = 0; i < size_; ++i) {
-      new (&data_[i]) value_type(v.data_[i]);
-    }
+  vector(const vector &v, const allocator_type &alloc) : vector(alloc) {
+    CopyFrom(v);
   }
 
   vector(vector &&v) noexcept
-      : data_(v.data_), size_(v.size_), capacity_(v.capacity_) {
+      : alloc_(std::move(v.alloc_)),
+        data_(v.data_),
+        size_(v.size_),
+        capacity_(v.capacity_),
+        deleter_(v.deleter_) {
     v.data_ = nullptr;
     v.size_ = 0;
     v.capacity_ = 0;
+    v.deleter_ = nullptr;
   }
 
   ~vector() noexcept {
-    if (this->data_) {
-      delete[] this->data_;
-    }
+    Deallocate();
 
     this->data_ = nullptr;
     this->size_ = this->capacity_ = 0;
   }
 
-  vector &operator=(vector &&v) noexcept {
+  vector &operator=(const vector &v) {
     if (this != &v) {
-      delete[] data_;
+      if (alloc_traits::propagate_on_container_copy_assignment::value &&
+          alloc_ != v.alloc_) {
+        Deallocate();
+      }
 
-      data_ = v.data_;
-      size_ = v.size_;
-      capacity_ = v.capacity_;
+      if (alloc_traits::propagate_on_container_copy_assignment::value) {
+        alloc_ = v.alloc_;
+      }
 
-      v.data_ = nullptr;
-      v.size_ = v.capacity_ = 0;
+      clear();
+      CopyFrom(v);
     }
 
     return *this;
   }
 
+  vector &operator=(vector &&v) noexcept(
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value) {
+    if (this != &v) {
+      if (alloc_traits::propagate_on_container_move_assignment::value ||
+          alloc_ == v.alloc_) {
+        Deallocate();
+
+        if (alloc_traits::propagate_on_container_move_assignment::value) {
+          alloc_ = std::move(v.alloc_);
+        }
+
+        data_ = v.data_;
+        size_ = v.size_;
+        capacity_ = v.capacity_;
+        deleter_ = v.deleter_;
+
+        v.data_ = nullptr;
+        v.size_ = v.capacity_ = 0;
+        v.deleter_ = nullptr;
+      } else {
+        clear();
+        Reallocate(v.size_);
+
+        for (; size_ < v.size_; ++size_) {
+          alloc_traits::construct(alloc_, data_ + size_,
+                                  std::move(v.data_[size_]));
+        }
+
+        v.clear();
+      }
+    }
+
+    return *this;
+  }
+
+  allocator_type get_allocator() const noexcept { return alloc_; }
+
   // Element access
   reference at(size_type pos) const {
     if (pos >= this->size_) {
@@ -158,129 +268,331 @@ class vector {
   size_type size() const noexcept { return size_; }
 
   size_type max_size() const noexcept {
-    return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+    size_type limit =
+        std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+    size_type alloc_limit = alloc_traits::max_size(alloc_);
+
+    return alloc_limit < limit ? alloc_limit : limit;
   }
 
-  void reserve(size_type size) noexcept {
+  void reserve(size_type size) {
     if (size <= capacity_) {
       return;
     }
 
-    auto *new_data = new value_type[size];
-
-    for (size_type i = 0; i < size_; ++i) {
-      new_data[i] = std::move(data_[i]);
+    if (size > max_size()) {
+      throw std::length_error("Out of container's limit");
     }
 
-    delete[] data_;
-
-    data_ = new_data;
-    capacity_ = size;
+    Reallocate(size);
   }
 
   size_type capacity() const noexcept { return capacity_; }
 
-  void shrink_to_fit() noexcept {
+  void shrink_to_fit() {
     if (size_ == capacity_) {
       return;
     }
 
-    if (size_ == 0) {
-      delete[] data_;
-      data_ = nullptr;
-      capacity_ = 0;
-    } else {
-      auto *new_data = new value_type[size_];
-
-      for (size_type i = 0; i < size_; ++i) {
-        new_data[i] = data_[i];
-      }
-
-      delete[] data_;
+    Reallocate(size_);
+  }
 
-      data_ = new_data;
-      capacity_ = size_;
+  // Modifiers
+  void clear() noexcept {
+    for (size_type i = 0; i < size_; ++i) {
+      alloc_traits::destroy(alloc_, data_ + i);
     }
+
+    size_ = 0;
   }
 
-  // Modifiers
-  void clear() noexcept { size_ = 0; }
+  iterator insert(iterator pos, const_reference value) {
+    size_type index = pos.GetPtr() - data_;
 
-  void insert(iterator pos, const_reference value) noexcept {
-    if (size_ >= capacity_) {
-      size_type new_capacity = (capacity_ == 0) ? 1 : capacity_ * 2;
-      reserve(new_capacity);
+    if (index > size_) {
+      throw std::out_of_range("Index out of bounds");
     }
 
-    size_type index = 0;
-    iterator it = begin();
-    while (it <= pos) {
-      ++it;
-      ++index;
-    }
+    value_type copy(value);
+    GrowIfFull();
 
-    for (size_type i = size_; i > index; --i) {
-      data_[i] = std::move(data_[i - 1]);
-    }
+    if (index == size_) {
+      alloc_traits::construct(alloc_, data_ + size_, std::move(copy));
+    } else {
+      alloc_traits::construct(alloc_, data_ + size_,
+                              std::move(data_[size_ - 1]));
+
+      for (size_type i = size_ - 1; i > index; --i) {
+        data_[i] = std::move(data_[i - 1]);
+      }
 
-    data_[index] = value;
+      data_[index] = std::move(copy);
+    }
 
     ++size_;
+    return iterator(data_ + index);
   }
 
   void erase(iterator pos) {
-    size_type index = 0;
-    iterator it = begin();
-    while (it != pos) {
-      ++it;
-      ++index;
-    }
+    size_type index = pos.GetPtr() - data_;
 
     if (index >= size_) {
       throw std::out_of_range("Index out of bounds");
     }
 
-    for (size_type i = index; i < size_ - 1; ++i) {
-      data_[i] = std::move(data_[i + 1]);
+    erase(pos, pos + 1);
+  }
+
+  // Moves the survivors behind last down in one pass and destroys the
+  // vacated tail once.
+  iterator erase(iterator first, iterator last) {
+    size_type begin = first.GetPtr() - data_;
+    size_type end = last.GetPtr() - data_;
+
+    if (begin > end || end > size_) {
+      throw std::out_of_range("Index out of bounds");
     }
 
-    data_[size_ - 1].~value_type();
+    if (begin != end) {
+      std::move(data_ + end, data_ + size_, data_ + begin);
+      DestroyTail(size_ - (end - begin));
+    }
 
-    --size_;
+    return iterator(data_ + begin);
   }
 
-  void push_back(const_reference value) noexcept {
-    if (size_ >= capacity_) {
-      size_type new_capacity = (capacity_ == 0) ? 1 : capacity_ * 2;
-      reserve(new_capacity);
+  // Removes every element matching pred, keeping the order of the rest.
+  // Survivors are compacted in a single pass. Returns the number removed.
+  template <typename Predicate>
+  size_type remove_if(Predicate pred) {
+    size_type kept = 0;
+
+    for (size_type i = 0; i < size_; ++i) {
+      if (!pred(data_[i])) {
+        if (kept != i) {
+          data_[kept] = std::move(data_[i]);
+        }
+        ++kept;
+      }
     }
 
-    data_[size_] = value;
+    size_type removed = size_ - kept;
+    DestroyTail(kept);
+    return removed;
+  }
+
+  void push_back(const_reference value) {
+    if (size_ < capacity_) {
+      alloc_traits::construct(alloc_, data_ + size_, value);
+    } else {
+      value_type copy(value);
+      GrowIfFull();
+      alloc_traits::construct(alloc_, data_ + size_, std::move(copy));
+    }
 
     ++size_;
   }
 
   void pop_back() noexcept {
     if (size_ > 0) {
-      data_[size_ - 1].~value_type();
+      alloc_traits::destroy(alloc_, data_ + size_ - 1);
 
       --size_;
     }
   }
 
   void swap(vector &other) noexcept {
+    if (alloc_traits::propagate_on_container_swap::value) {
+      std::swap(alloc_, other.alloc_);
+    }
+
     std::swap(data_, other.data_);
 
     std::swap(size_, other.size_);
 
     std::swap(capacity_, other.capacity_);
+
+    std::swap(deleter_, other.deleter_);
+  }
+
+  // Sets the size to n without initializing new elements, so a buffer can be
+  // filled directly by read() or recv().
+  void resize_uninitialized(size_type n) {
+    static_assert(std::is_trivially_default_constructible<value_type>::value &&
+                      std::is_trivially_destructible<value_type>::value,
+                  "resize_uninitialized needs a trivial value type");
+
+    reserve(n);
+    size_ = n;
+  }
+
+  // Takes ownership of an externally allocated buffer holding size
+  // constructed elements. The buffer is freed with deleter(data, capacity),
+  // or with this vector's allocator if deleter is nullptr.
+  void adopt(pointer data, size_type size, size_type capacity,
+             deleter_type deleter) {
+    if (size > capacity) {
+      throw std::invalid_argument("Size exceeds capacity");
+    }
+
+    Deallocate();
+
+    data_ = data;
+    size_ = size;
+    capacity_ = capacity;
+    deleter_ = (data == nullptr || deleter == &AllocatorDeleter) ? nullptr
+                                                                 : deleter;
+  }
+
+  struct released_buffer {
+    pointer data;
+    size_type size;
+    size_type capacity;
+    deleter_type deleter;
+  };
+
+  // Hands the buffer and its elements over to the caller without copying
+  // and leaves the vector empty. The elements are not destroyed; the buffer
+  // must be freed with deleter(data, capacity) or passed back to adopt().
+  released_buffer release() noexcept {
+    static_assert(alloc_traits::is_always_equal::value,
+                  "release() needs a stateless allocator");
+
+    released_buffer buffer{data_, size_, capacity_,
+                           deleter_ ? deleter_ : &AllocatorDeleter};
+    if (data_ == nullptr) {
+      buffer.deleter = nullptr;
+    }
+
+    data_ = nullptr;
+    size_ = capacity_ = 0;
+    deleter_ = nullptr;
+    return buffer;
   }
 
  private:
+  void GrowIfFull() {
+    if (size_ >= capacity_) {
+      size_type new_capacity = growth_policy::next_capacity(
+          capacity_, size_ + 1, sizeof(value_type));
+      reserve(new_capacity < max_size() ? new_capacity : max_size());
+    }
+  }
+
+  void DestroyTail(size_type new_size) noexcept {
+    if constexpr (!std::is_trivially_destructible<value_type>::value) {
+      for (size_type i = new_size; i < size_; ++i) {
+        alloc_traits::destroy(alloc_, data_ + i);
+      }
+    }
+
+    size_ = new_size;
+  }
+
+  void CopyFrom(const vector &v) {
+    reserve(v.size_);
+
+    for (; size_ < v.size_; ++size_) {
+      alloc_traits::construct(alloc_, data_ + size_, v.data_[size_]);
+    }
+  }
+
+  static void AllocatorDeleter(pointer data, size_type capacity) noexcept {
+    allocator_type alloc;
+    alloc_traits::deallocate(alloc, data, capacity);
+  }
+
+  void FreeBuffer() noexcept {
+    if (deleter_) {
+      deleter_(data_, capacity_);
+      deleter_ = nullptr;
+    } else {
+      alloc_traits::deallocate(alloc_, data_, capacity_);
+    }
+  }
+
+  void Reallocate(size_type new_capacity) {
+    if constexpr (kCanReallocate) {
+      if (data_ && new_capacity > 0 && deleter_ == nullptr) {
+        data_ = alloc_.reallocate(data_, capacity_, new_capacity);
+        capacity_ = new_capacity;
+        return;
+      }
+    }
+
+    pointer new_data = nullptr;
+
+    if (new_capacity > 0) {
+      new_data = alloc_traits::allocate(alloc_, new_capacity);
+    }
+
+    // Every element is built in the new buffer before any old one is
+    // destroyed, so a throwing copy leaves the vector untouched.
+    size_type built = 0;
+
+    try {
+      for (; built < size_; ++built) {
+        alloc_traits::construct(alloc_, new_data + built,
+                                std::move_if_noexcept(data_[built]));
+      }
+    } catch (...) {
+      for (size_type i = 0; i < built; ++i) {
+        alloc_traits::destroy(alloc_, new_data + i);
+      }
+
+      if (new_data) {
+        alloc_traits::deallocate(alloc_, new_data, new_capacity);
+      }
+
+      throw;
+    }
+
+    if (data_) {
+      if constexpr (!std::is_trivially_destructible<value_type>::value) {
+        for (size_type i = 0; i < size_; ++i) {
+          alloc_traits::destroy(alloc_, data_ + i);
+        }
+      }
+
+      FreeBuffer();
+    }
+
+    data_ = new_data;
+    capacity_ = new_capacity;
+  }
+
+  void Deallocate() noexcept {
+    clear();
+
+    if (data_) {
+      FreeBuffer();
+      data_ = nullptr;
+      capacity_ = 0;
+    }
+  }
+
+  allocator_type alloc_;
   value_type *data_;
   size_type size_;
   size_type capacity_;
+  deleter_type deleter_;
 };
+
+// Removes the elements equal to value or matching pred in a single pass and
+// returns how many were removed.
+template <typename T, typename Allocator, typename GrowthPolicy, typename U>
+size_t erase(vector<T, Allocator, GrowthPolicy> &v, const U &value) {
+  return v.remove_if([&](const T &element) { return element == value; });
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy,
+          typename Predicate>
+size_t erase_if(vector<T, Allocator, GrowthPolicy> &v, Predicate pred) {
+  return v.remove_if(pred);
+}
 }  // namespace s21
 
+// Bit-packed vector<bool> specialization.
+#include "s21_dynamic_bitset.h"
+
 #endif  // S21_VECTOR_H
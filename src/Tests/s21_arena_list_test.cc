@@ -0,0 +1,260 @@
+#include "../Containers/s21_arena_list.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+template <typename value_type>
+bool CompareArenaLists(const s21::arena_list<value_type>& my_list,
+                       const std::list<value_type>& std_list) {
+  return my_list.size() == std_list.size() &&
+         std::distance(my_list.begin(), my_list.end()) ==
+             static_cast<std::ptrdiff_t>(std_list.size()) &&
+         std::equal(my_list.begin(), my_list.end(), std_list.begin());
+}
+
+// Counts live objects and throws once copies_left copies have been made.
+struct ArenaThrowingCopy {
+  ArenaThrowingCopy(int value, int* live, int* copies_left)
+      : value(value), live(live), copies_left(copies_left) {
+    ++*live;
+  }
+  ArenaThrowingCopy(const ArenaThrowingCopy& other)
+      : value(other.value), live(other.live), copies_left(other.copies_left) {
+    if ((*copies_left)-- == 0) {
+      throw std::runtime_error("copy");
+    }
+    ++*live;
+  }
+  ~ArenaThrowingCopy() { --*live; }
+
+  int value;
+  int* live;
+  int* copies_left;
+};
+
+TEST(ArenaListConstructors, Default) {
+  s21::arena_list<int> my_list;
+
+  EXPECT_TRUE(my_list.empty());
+  EXPECT_EQ(my_list.capacity(), 0);
+  EXPECT_EQ(my_list.begin(), my_list.end());
+}
+
+TEST(ArenaListConstructors, CopyAndMove) {
+  s21::arena_list<std::string> my_list_1 = {"a", "b", "c"};
+  s21::arena_list<std::string> my_list_2(my_list_1);
+  s21::arena_list<std::string> my_list_3(std::move(my_list_1));
+  s21::arena_list<std::string> my_list_4 = {"x", "y"};
+  my_list_4 = my_list_2;
+  s21::arena_list<std::string> my_list_5;
+  my_list_5 = std::move(my_list_3);
+
+  std::list<std::string> std_list = {"a", "b", "c"};
+  EXPECT_TRUE(my_list_1.empty());
+  EXPECT_TRUE(CompareArenaLists(my_list_2, std_list));
+  EXPECT_TRUE(CompareArenaLists(my_list_4, std_list));
+  EXPECT_TRUE(CompareArenaLists(my_list_5, std_list));
+}
+
+TEST(ArenaListModifiers, RandomInsertEraseMatchesStdList) {
+  s21::arena_list<int> my_list;
+  std::list<int> std_list;
+  std::mt19937 gen(13);
+
+  for (int i = 0; i < 5000; ++i) {
+    size_t pos = std_list.empty() ? 0 : gen() % (std_list.size() + 1);
+    auto my_it = std::next(my_list.begin(), pos);
+    auto std_it = std::next(std_list.begin(), pos);
+
+    if (gen() % 3 == 0 && std_it != std_list.end()) {
+      my_list.erase(my_it);
+      std_list.erase(std_it);
+    } else {
+      EXPECT_EQ(*my_list.insert(my_it, i), i);
+      std_list.insert(std_it, i);
+    }
+  }
+
+  EXPECT_TRUE(CompareArenaLists(my_list, std_list));
+  EXPECT_EQ(*--my_list.end(), std_list.back());
+}
+
+TEST(ArenaListModifiers, ErasedSlotsAreReused) {
+  s21::arena_list<int> my_list;
+  for (int i = 0; i < 100; ++i) {
+    my_list.push_back(i);
+  }
+  size_t capacity = my_list.capacity();
+
+  for (int round = 0; round < 10; ++round) {
+    for (int i = 0; i < 50; ++i) {
+      my_list.pop_front();
+    }
+    for (int i = 0; i < 50; ++i) {
+      my_list.push_back(i);
+    }
+  }
+
+  EXPECT_EQ(my_list.size(), 100);
+  EXPECT_EQ(my_list.capacity(), capacity);
+}
+
+TEST(ArenaListModifiers, IteratorsSurviveGrowth) {
+  s21::arena_list<std::string> my_list = {"first"};
+  auto first = my_list.begin();
+
+  for (int i = 0; i < 1000; ++i) {
+    my_list.push_back(my_list.front());
+  }
+
+  EXPECT_EQ(*first, "first");
+  EXPECT_EQ(my_list.size(), 1001);
+  EXPECT_EQ(my_list.back(), "first");
+}
+
+TEST(ArenaListModifiers, ThrowingGrowthKeepsElements) {
+  int live = 0;
+  int copies_left = 100;
+  {
+    s21::arena_list<ArenaThrowingCopy> my_list;
+    for (int i = 0; i < 4; ++i) {
+      my_list.emplace_back(i, &live, &copies_left);
+    }
+    size_t capacity = my_list.capacity();
+
+    copies_left = 2;
+    EXPECT_THROW(my_list.reserve(capacity * 4), std::runtime_error);
+    EXPECT_EQ(my_list.capacity(), capacity);
+    EXPECT_EQ(live, 4);
+    EXPECT_EQ(my_list.back().value, 3);
+
+    copies_left = 100;
+    my_list.reserve(capacity * 4);
+    EXPECT_EQ(my_list.front().value, 0);
+    EXPECT_EQ(live, 4);
+  }
+  EXPECT_EQ(live, 0);
+}
+
+TEST(ArenaListModifiers, ClearKeepsSlab) {
+  s21::arena_list<int> my_list;
+  my_list.reserve(500);
+  for (int i = 0; i < 500; ++i) {
+    my_list.push_front(i);
+  }
+  size_t capacity = my_list.capacity();
+
+  my_list.clear();
+  EXPECT_TRUE(my_list.empty());
+  EXPECT_EQ(my_list.begin(), my_list.end());
+  EXPECT_EQ(my_list.capacity(), capacity);
+
+  my_list.push_back(7);
+  EXPECT_EQ(my_list.front(), 7);
+}
+
+TEST(ArenaListModifiers, ClearDestroysElements) {
+  auto shared = std::make_shared<int>(1);
+  s21::arena_list<std::shared_ptr<int>> my_list;
+  for (int i = 0; i < 10; ++i) {
+    my_list.push_back(shared);
+  }
+  my_list.pop_back();
+  EXPECT_EQ(shared.use_count(), 10);
+
+  my_list.clear();
+  EXPECT_EQ(shared.use_count(), 1);
+}
+
+TEST(ArenaListModifiers, EmplaceAndMoveOnly) {
+  s21::arena_list<std::unique_ptr<int>> my_list;
+
+  my_list.emplace_back(new int(2));
+  my_list.push_front(std::make_unique<int>(1));
+  my_list.emplace(my_list.end(), new int(3));
+
+  EXPECT_EQ(*my_list.front(), 1);
+  EXPECT_EQ(*my_list.back(), 3);
+  EXPECT_THROW(my_list.erase(my_list.end()), std::invalid_argument);
+}
+
+TEST(ArenaListOperations, SpliceWithinAndBetweenLists) {
+  s21::arena_list<int> my_list_1 = {1, 2, 3, 4};
+  s21::arena_list<int> my_list_2 = {10, 20, 30};
+  std::list<int> std_list_1 = {1, 2, 3, 4};
+  std::list<int> std_list_2 = {10, 20, 30};
+
+  my_list_1.splice(my_list_1.begin(), my_list_1, --my_list_1.end());
+  std_list_1.splice(std_list_1.begin(), std_list_1, --std_list_1.end());
+  my_list_1.splice(std::next(my_list_1.begin(), 2), my_list_2,
+                   std::next(my_list_2.begin()), my_list_2.end());
+  std_list_1.splice(std::next(std_list_1.begin(), 2), std_list_2,
+                    std::next(std_list_2.begin()), std_list_2.end());
+  my_list_1.splice(my_list_1.end(), my_list_2);
+  std_list_1.splice(std_list_1.end(), std_list_2);
+
+  EXPECT_TRUE(CompareArenaLists(my_list_1, std_list_1));
+  EXPECT_TRUE(my_list_2.empty());
+}
+
+TEST(ArenaListOperations, SortMergeReverseUnique) {
+  s21::arena_list<int> my_list_1;
+  s21::arena_list<int> my_list_2;
+  std::list<int> std_list_1;
+  std::list<int> std_list_2;
+  std::mt19937 gen(17);
+  for (int i = 0; i < 300; ++i) {
+    int value = gen() % 50;
+    (i % 2 ? my_list_1 : my_list_2).push_back(value);
+    (i % 2 ? std_list_1 : std_list_2).push_back(value);
+  }
+
+  my_list_1.sort();
+  std_list_1.sort();
+  my_list_2.sort(std::greater<>());
+  std_list_2.sort(std::greater<>());
+  my_list_2.reverse();
+  std_list_2.reverse();
+  my_list_1.merge(my_list_2);
+  std_list_1.merge(std_list_2);
+  my_list_1.unique();
+  std_list_1.unique();
+
+  EXPECT_TRUE(CompareArenaLists(my_list_1, std_list_1));
+  EXPECT_TRUE(my_list_2.empty());
+}
+
+TEST(ArenaListOperations, SortThrowingComparatorKeepsElements) {
+  s21::arena_list<int> my_list = {5, 4, 3, 2, 1, 0};
+  int calls = 0;
+  auto comp = [&calls](int a, int b) {
+    if (++calls == 4) {
+      throw std::runtime_error("compare");
+    }
+    return a < b;
+  };
+
+  EXPECT_THROW(my_list.sort(comp), std::runtime_error);
+
+  std::vector<int> forward(my_list.begin(), my_list.end());
+  std::vector<int> backward;
+  for (auto it = my_list.end(); it != my_list.begin();) {
+    backward.push_back(*--it);
+  }
+  std::reverse(backward.begin(), backward.end());
+  EXPECT_EQ(forward, backward);
+  std::sort(forward.begin(), forward.end());
+  EXPECT_EQ(forward, std::vector<int>({0, 1, 2, 3, 4, 5}));
+
+  my_list.sort();
+  EXPECT_EQ(my_list.front(), 0);
+  EXPECT_EQ(my_list.back(), 5);
+}
@@ -0,0 +1,168 @@
+#include "../Containers/s21_cow_vector.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(CowVectorConstructors, Default) {
+  s21::cow_vector<int> s21_v;
+
+  EXPECT_TRUE(s21_v.empty());
+  EXPECT_EQ(s21_v.use_count(), 0);
+  EXPECT_EQ(s21_v.begin(), s21_v.end());
+}
+
+TEST(CowVectorConstructors, FromVectorWithoutCopy) {
+  s21::vector<std::string> items = {"a", "b", "c"};
+  const std::string *data = items.data();
+
+  const s21::cow_vector<std::string> s21_v(std::move(items));
+
+  EXPECT_EQ(s21_v.data(), data);
+  EXPECT_EQ(s21_v.size(), 3);
+  EXPECT_EQ(s21_v.items().size(), 3);
+}
+
+TEST(CowVectorSharing, CopiesShareBuffer) {
+  const s21::cow_vector<int> s21_v_1 = {1, 2, 3};
+  std::vector<s21::cow_vector<int>> stages(16, s21_v_1);
+
+  EXPECT_EQ(s21_v_1.use_count(), 17);
+  for (const auto &stage : stages) {
+    EXPECT_EQ(stage.data(), s21_v_1.data());
+    EXPECT_EQ(stage[2], 3);
+  }
+
+  stages.clear();
+  EXPECT_EQ(s21_v_1.use_count(), 1);
+}
+
+TEST(CowVectorSharing, MutationClones) {
+  s21::cow_vector<std::string> s21_v_1 = {"a", "b"};
+  s21::cow_vector<std::string> s21_v_2 = s21_v_1;
+  const std::string *shared = s21_v_1.cbegin();
+
+  s21_v_2.push_back("c");
+
+  EXPECT_EQ(s21_v_1.cbegin(), shared);
+  EXPECT_NE(s21_v_2.cbegin(), shared);
+  EXPECT_EQ(s21_v_1.size(), 2);
+  EXPECT_EQ(s21_v_2.size(), 3);
+  EXPECT_EQ(s21_v_1.use_count(), 1);
+  EXPECT_EQ(s21_v_2.use_count(), 1);
+
+  const std::string *owned = s21_v_2.cbegin();
+  s21_v_2[0] = "z";
+  EXPECT_EQ(s21_v_2.cbegin(), owned);
+  EXPECT_EQ(s21_v_1[0], "a");
+}
+
+TEST(CowVectorSharing, NonConstAccessClones) {
+  s21::cow_vector<int> s21_v_1 = {1, 2, 3};
+  s21::cow_vector<int> s21_v_2 = s21_v_1;
+
+  s21_v_2.at(1) = 20;
+  *s21_v_1.begin() = 10;
+
+  EXPECT_EQ(s21_v_1[0], 10);
+  EXPECT_EQ(s21_v_1[1], 2);
+  EXPECT_EQ(s21_v_2[0], 1);
+  EXPECT_EQ(s21_v_2[1], 20);
+  EXPECT_THROW(s21_v_2.at(3), std::out_of_range);
+}
+
+TEST(CowVectorSharing, ReferenceTakenBeforeCopy) {
+  s21::cow_vector<int> s21_v_1 = {1, 2, 3};
+  int &first = s21_v_1[0];
+  s21::cow_vector<int> s21_v_2(s21_v_1);
+  s21::cow_vector<int> s21_v_3;
+  s21_v_3 = s21_v_1;
+
+  first = 42;
+
+  EXPECT_EQ(s21_v_2[0], 1);
+  EXPECT_EQ(s21_v_3[0], 1);
+  EXPECT_EQ(s21_v_1.use_count(), 1);
+
+  s21_v_1.clear();
+  s21_v_1.push_back(7);
+  s21::cow_vector<int> s21_v_4(s21_v_1);
+  EXPECT_EQ(s21_v_1.use_count(), 2);
+}
+
+TEST(CowVectorSharing, IteratorFromInsertBeforeCopy) {
+  s21::cow_vector<int> s21_v_1 = {1, 2, 3};
+  auto it = s21_v_1.insert(s21_v_1.cbegin(), 9);
+  s21::cow_vector<int> s21_v_2(s21_v_1);
+
+  *it = 42;
+
+  EXPECT_EQ(s21_v_2[0], 9);
+  EXPECT_EQ(s21_v_1[0], 42);
+}
+
+TEST(CowVectorModifiers, InsertEraseClear) {
+  s21::cow_vector<int> s21_v_1 = {1, 2, 3};
+  s21::cow_vector<int> s21_v_2 = s21_v_1;
+
+  auto it = s21_v_2.insert(s21_v_2.cbegin() + 1, 5);
+  EXPECT_EQ(*it, 5);
+  s21_v_2.erase(s21_v_2.cbegin());
+  EXPECT_EQ(s21_v_2.front(), 5);
+  EXPECT_EQ(s21_v_2.back(), 3);
+  EXPECT_EQ(s21_v_1.size(), 3);
+
+  s21::cow_vector<int> s21_v_3 = s21_v_1;
+  s21_v_3.clear();
+  EXPECT_TRUE(s21_v_3.empty());
+  EXPECT_EQ(s21_v_1.size(), 3);
+  s21_v_3.pop_back();
+  s21_v_3.push_back(4);
+  EXPECT_EQ(s21_v_3[0], 4);
+
+  EXPECT_THROW(s21_v_1.erase(s21_v_1.cend()), std::out_of_range);
+}
+
+TEST(CowVectorModifiers, AssignAndSwap) {
+  s21::cow_vector<int> s21_v_1 = {1, 2, 3};
+  s21::cow_vector<int> s21_v_2 = {4};
+  s21::cow_vector<int> s21_v_3;
+
+  s21_v_2 = s21_v_1;
+  s21_v_3 = std::move(s21_v_2);
+  EXPECT_EQ(s21_v_1.use_count(), 2);
+  EXPECT_TRUE(s21_v_2.empty());
+
+  s21_v_3.swap(s21_v_2);
+  EXPECT_TRUE(s21_v_3.empty());
+  EXPECT_EQ(s21_v_2.cbegin(), s21_v_1.cbegin());
+}
+
+TEST(CowVectorSharing, ConcurrentCopies) {
+  s21::cow_vector<int> source(100000);
+  std::vector<std::thread> threads;
+  std::vector<long> sums(8, 0);
+
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < 100; ++i) {
+        s21::cow_vector<int> copy = source;
+        if (i % 10 == 0) {
+          copy[0] = t;
+        }
+        const auto &view = copy;
+        sums[t] += view[0] + view[99999];
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(source.use_count(), 1);
+  for (int t = 0; t < 8; ++t) {
+    EXPECT_EQ(sums[t], 10 * t);
+  }
+}
@@ -0,0 +1,272 @@
+#include "../Containers/s21_deque.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+
+template <typename T>
+struct DequeCountingAllocator {
+  using value_type = T;
+
+  explicit DequeCountingAllocator(int* allocations) noexcept
+      : allocations(allocations) {}
+  template <typename U>
+  DequeCountingAllocator(const DequeCountingAllocator<U>& other) noexcept
+      : allocations(other.allocations) {}
+
+  T* allocate(size_t n) {
+    ++*allocations;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* p, size_t n) noexcept {
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  template <typename U>
+  bool operator==(const DequeCountingAllocator<U>& rhs) const noexcept {
+    return allocations == rhs.allocations;
+  }
+  template <typename U>
+  bool operator!=(const DequeCountingAllocator<U>& rhs) const noexcept {
+    return allocations != rhs.allocations;
+  }
+
+  int* allocations;
+};
+
+TEST(DequeConstructors, Default) {
+  s21::deque<int> s21_d;
+
+  EXPECT_TRUE(s21_d.empty());
+  EXPECT_EQ(s21_d.size(), 0);
+  EXPECT_EQ(s21_d.begin(), s21_d.end());
+}
+
+TEST(DequeConstructors, SizeAndInitializerList) {
+  s21::deque<int> s21_d_1(5000);
+  s21::deque<std::string> s21_d_2 = {"a", "b", "c"};
+
+  EXPECT_EQ(s21_d_1.size(), 5000);
+  EXPECT_EQ(s21_d_1[4999], 0);
+  EXPECT_EQ(s21_d_2.front(), "a");
+  EXPECT_EQ(s21_d_2.back(), "c");
+}
+
+TEST(DequeConstructors, CopyAndMove) {
+  s21::deque<std::string> s21_d_1;
+  for (int i = 0; i < 3000; ++i) {
+    s21_d_1.push_front(std::to_string(i));
+  }
+
+  s21::deque<std::string> s21_d_2(s21_d_1);
+  s21::deque<std::string> s21_d_3(std::move(s21_d_1));
+  s21::deque<std::string> s21_d_4;
+  s21_d_4 = s21_d_2;
+  s21::deque<std::string> s21_d_5 = {"x"};
+  s21_d_5 = std::move(s21_d_3);
+
+  EXPECT_TRUE(s21_d_1.empty());
+  EXPECT_EQ(s21_d_2.size(), 3000);
+  EXPECT_TRUE(std::equal(s21_d_2.begin(), s21_d_2.end(), s21_d_4.begin()));
+  EXPECT_TRUE(std::equal(s21_d_2.begin(), s21_d_2.end(), s21_d_5.begin()));
+  EXPECT_EQ(s21_d_5.front(), "2999");
+}
+
+TEST(DequeElementAccess, At) {
+  s21::deque<int> s21_d = {1, 2, 3};
+
+  EXPECT_EQ(s21_d.at(1), 2);
+  EXPECT_THROW(s21_d.at(3), std::out_of_range);
+}
+
+TEST(DequeModifiers, PushPopBothEnds) {
+  s21::deque<int> s21_d;
+  std::deque<int> std_d;
+  std::mt19937 gen(7);
+
+  for (int i = 0; i < 200000; ++i) {
+    switch (gen() % 5) {
+      case 0:
+      case 1:
+        s21_d.push_back(i);
+        std_d.push_back(i);
+        break;
+      case 2:
+        s21_d.push_front(i);
+        std_d.push_front(i);
+        break;
+      case 3:
+        if (!std_d.empty()) {
+          s21_d.pop_back();
+          std_d.pop_back();
+        }
+        break;
+      default:
+        if (!std_d.empty()) {
+          s21_d.pop_front();
+          std_d.pop_front();
+        }
+        break;
+    }
+  }
+
+  ASSERT_EQ(s21_d.size(), std_d.size());
+  EXPECT_TRUE(std::equal(std_d.begin(), std_d.end(), s21_d.begin()));
+  for (size_t i = 0; i < std_d.size(); i += 101) {
+    EXPECT_EQ(s21_d[i], std_d[i]);
+  }
+}
+
+TEST(DequeModifiers, QueueUsage) {
+  s21::deque<size_t> s21_d;
+
+  for (size_t i = 0; i < 1000000; ++i) {
+    s21_d.push_back(i);
+    if (s21_d.size() > 1000) {
+      EXPECT_EQ(s21_d.front(), i - 1000);
+      s21_d.pop_front();
+    }
+  }
+
+  EXPECT_EQ(s21_d.size(), 1000);
+  EXPECT_EQ(s21_d.back(), 999999);
+}
+
+TEST(DequeModifiers, ReferencesStayValid) {
+  s21::deque<int> s21_d;
+  std::vector<int *> addresses;
+
+  for (int i = 0; i < 1000; ++i) {
+    addresses.push_back(&s21_d.emplace_back(i));
+  }
+  for (int i = 0; i < 100000; ++i) {
+    s21_d.push_back(i);
+    s21_d.push_front(-i);
+  }
+
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(*addresses[i], i);
+    EXPECT_EQ(addresses[i], &s21_d[100000 + i]);
+  }
+}
+
+TEST(DequeModifiers, NonMovable) {
+  s21::deque<std::mutex> s21_d;
+
+  for (int i = 0; i < 600; ++i) {
+    s21_d.emplace_back();
+    s21_d.emplace_front();
+  }
+  s21_d.pop_back();
+  s21_d.pop_front();
+
+  EXPECT_EQ(s21_d.size(), 1198);
+  EXPECT_TRUE(s21_d[500].try_lock());
+  s21_d[500].unlock();
+}
+
+TEST(DequeModifiers, InsertErase) {
+  s21::deque<std::string> s21_d;
+  std::deque<std::string> std_d;
+  for (int i = 0; i < 2000; ++i) {
+    s21_d.push_back(std::to_string(i));
+    std_d.push_back(std::to_string(i));
+  }
+
+  for (size_t pos : {0, 1, 700, 1500, 2003}) {
+    auto s21_it = s21_d.insert(s21_d.begin() + pos, "new");
+    std_d.insert(std_d.begin() + pos, "new");
+    EXPECT_EQ(*s21_it, "new");
+  }
+  for (size_t pos : {0, 3, 400, 1800, 2000}) {
+    s21_d.erase(s21_d.begin() + pos);
+    std_d.erase(std_d.begin() + pos);
+  }
+
+  ASSERT_EQ(s21_d.size(), std_d.size());
+  EXPECT_TRUE(std::equal(std_d.begin(), std_d.end(), s21_d.begin()));
+  EXPECT_THROW(s21_d.insert(s21_d.end() + 1, "x"), std::out_of_range);
+  EXPECT_THROW(s21_d.erase(s21_d.end()), std::out_of_range);
+}
+
+TEST(DequeIterators, RandomAccess) {
+  s21::deque<int> s21_d;
+  std::mt19937 gen(3);
+  for (int i = 0; i < 10000; ++i) {
+    s21_d.push_front(static_cast<int>(gen() % 1000));
+  }
+
+  std::sort(s21_d.begin(), s21_d.end());
+
+  EXPECT_TRUE(std::is_sorted(s21_d.begin(), s21_d.end()));
+  EXPECT_EQ(s21_d.end() - s21_d.begin(), 10000);
+  EXPECT_EQ(s21_d.begin()[9999], s21_d.back());
+}
+
+TEST(DequeCapacity, ClearAndShrink) {
+  s21::deque<int> s21_d;
+  for (int i = 0; i < 10000; ++i) {
+    s21_d.push_back(i);
+  }
+
+  for (int i = 0; i < 9990; ++i) {
+    s21_d.pop_front();
+  }
+  s21_d.shrink_to_fit();
+  EXPECT_EQ(s21_d.front(), 9990);
+  EXPECT_EQ(s21_d.back(), 9999);
+
+  s21_d.clear();
+  EXPECT_TRUE(s21_d.empty());
+  s21_d.push_front(1);
+  EXPECT_EQ(s21_d.front(), 1);
+  s21_d.pop_back();
+  s21_d.shrink_to_fit();
+  EXPECT_TRUE(s21_d.empty());
+}
+
+TEST(DequeCapacity, SpareBlockAtEachEnd) {
+  int allocations = 0;
+  using Alloc = DequeCountingAllocator<int>;
+  s21::deque<int, Alloc> s21_d{Alloc(&allocations)};
+  s21_d.push_back(0);
+
+  int before = allocations;
+  while (allocations == before) {
+    s21_d.push_back(1);
+  }
+  before = allocations;
+  while (allocations == before) {
+    s21_d.push_front(2);
+  }
+
+  before = allocations;
+  for (int i = 0; i < 100; ++i) {
+    s21_d.pop_back();
+    s21_d.pop_front();
+    s21_d.push_back(3);
+    s21_d.push_front(4);
+  }
+  EXPECT_EQ(allocations, before);
+  EXPECT_EQ(s21_d.front(), 4);
+  EXPECT_EQ(s21_d.back(), 3);
+
+  s21_d.clear();
+  s21_d.shrink_to_fit();
+  EXPECT_TRUE(s21_d.empty());
+}
+
+TEST(DequeModifiers, Swap) {
+  s21::deque<int> s21_d_1 = {1, 2, 3};
+  s21::deque<int> s21_d_2;
+
+  s21_d_1.swap(s21_d_2);
+
+  EXPECT_TRUE(s21_d_1.empty());
+  EXPECT_EQ(s21_d_2.size(), 3);
+}
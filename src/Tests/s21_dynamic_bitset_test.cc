@@ -0,0 +1,202 @@
+#include "../Containers/s21_dynamic_bitset.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <bitset>
+#include <random>
+#include <utility>
+#include <vector>
+
+static s21::dynamic_bitset<> RandomBits(size_t n, unsigned seed) {
+  std::mt19937 gen(seed);
+  s21::dynamic_bitset<> bits(n);
+  for (size_t i = 0; i < n; ++i) {
+    if (gen() % 3 == 0) {
+      bits.set(i);
+    }
+  }
+  return bits;
+}
+
+TEST(DynamicBitsetConstructors, SizeAndValue) {
+  s21::dynamic_bitset<> zeros(130);
+  s21::dynamic_bitset<> ones(130, true);
+
+  EXPECT_EQ(zeros.size(), 130);
+  EXPECT_EQ(zeros.num_words(), 3);
+  EXPECT_TRUE(zeros.none());
+  EXPECT_TRUE(ones.all());
+  EXPECT_EQ(ones.count(), 130);
+}
+
+TEST(DynamicBitsetConstructors, InitializerList) {
+  s21::dynamic_bitset<> bits = {true, false, true, true};
+
+  EXPECT_EQ(bits.size(), 4);
+  EXPECT_TRUE(bits[0]);
+  EXPECT_FALSE(bits[1]);
+  EXPECT_EQ(bits.count(), 3);
+}
+
+TEST(DynamicBitsetModifiers, SetResetFlip) {
+  s21::dynamic_bitset<> bits(100);
+
+  bits.set(3).set(64).set(99);
+  bits.reset(3);
+  bits.flip(0);
+
+  EXPECT_TRUE(bits.test(0));
+  EXPECT_FALSE(bits.test(3));
+  EXPECT_TRUE(bits.test(64));
+  EXPECT_EQ(bits.count(), 3);
+  EXPECT_THROW(bits.set(100), std::out_of_range);
+  EXPECT_THROW(bits.test(100), std::out_of_range);
+
+  bits.flip();
+  EXPECT_EQ(bits.count(), 97);
+  bits.set();
+  EXPECT_TRUE(bits.all());
+  bits.reset();
+  EXPECT_TRUE(bits.none());
+}
+
+TEST(DynamicBitsetModifiers, PushPopResize) {
+  s21::dynamic_bitset<> bits;
+  std::vector<bool> expected;
+
+  for (int i = 0; i < 200; ++i) {
+    bits.push_back(i % 5 == 0);
+    expected.push_back(i % 5 == 0);
+  }
+  for (int i = 0; i < 70; ++i) {
+    bits.pop_back();
+    expected.pop_back();
+  }
+  bits.resize(250, true);
+  expected.resize(250, true);
+  bits.resize(140);
+  expected.resize(140);
+
+  ASSERT_EQ(bits.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(bits[i], expected[i]);
+  }
+  EXPECT_EQ(bits.count(), static_cast<size_t>(std::count(
+                              expected.begin(), expected.end(), true)));
+}
+
+TEST(DynamicBitsetModifiers, InsertErase) {
+  s21::dynamic_bitset<> bits = RandomBits(300, 1);
+  std::vector<bool> expected;
+  for (size_t i = 0; i < bits.size(); ++i) {
+    expected.push_back(bits[i]);
+  }
+
+  for (size_t pos : {0, 63, 64, 150, 301}) {
+    bits.insert(pos, true);
+    expected.insert(expected.begin() + pos, true);
+  }
+  for (size_t pos : {0, 63, 64, 200, 299}) {
+    bits.erase(pos);
+    expected.erase(expected.begin() + pos);
+  }
+
+  ASSERT_EQ(bits.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(bits[i], expected[i]) << i;
+  }
+  EXPECT_THROW(bits.insert(bits.size() + 1, true), std::out_of_range);
+  EXPECT_THROW(bits.erase(bits.size()), std::out_of_range);
+}
+
+TEST(DynamicBitsetModifiers, EraseRange) {
+  for (auto range : {std::make_pair(0, 0), std::make_pair(0, 64),
+                     std::make_pair(3, 70), std::make_pair(64, 128),
+                     std::make_pair(100, 101), std::make_pair(130, 300),
+                     std::make_pair(0, 300)}) {
+    s21::dynamic_bitset<> bits = RandomBits(300, 4);
+    std::vector<bool> expected;
+    for (size_t i = 0; i < bits.size(); ++i) {
+      expected.push_back(bits[i]);
+    }
+
+    bits.erase(range.first, range.second);
+    expected.erase(expected.begin() + range.first,
+                   expected.begin() + range.second);
+
+    ASSERT_EQ(bits.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ(bits[i], expected[i]) << range.first << " " << i;
+    }
+    EXPECT_EQ(bits.count(),
+              static_cast<size_t>(
+                  std::count(expected.begin(), expected.end(), true)));
+  }
+
+  s21::dynamic_bitset<> bits(10);
+  EXPECT_THROW(bits.erase(5, 11), std::out_of_range);
+  EXPECT_THROW(bits.erase(6, 5), std::out_of_range);
+}
+
+TEST(DynamicBitsetOperations, Bitwise) {
+  s21::dynamic_bitset<> a = RandomBits(1000, 2);
+  s21::dynamic_bitset<> b = RandomBits(1000, 3);
+
+  s21::dynamic_bitset<> both = a & b;
+  s21::dynamic_bitset<> either = a | b;
+  s21::dynamic_bitset<> one = a ^ b;
+  s21::dynamic_bitset<> not_a = ~a;
+
+  for (size_t i = 0; i < a.size(); ++i) {
+    EXPECT_EQ(both[i], a[i] && b[i]);
+    EXPECT_EQ(either[i], a[i] || b[i]);
+    EXPECT_EQ(one[i], a[i] != b[i]);
+    EXPECT_EQ(not_a[i], !a[i]);
+  }
+  EXPECT_EQ(not_a.count(), 1000 - a.count());
+  EXPECT_TRUE((a ^ a).none());
+  EXPECT_TRUE(a == (a | a));
+  EXPECT_TRUE(a != b);
+
+  s21::dynamic_bitset<> short_bits(10);
+  EXPECT_THROW(a &= short_bits, std::invalid_argument);
+}
+
+TEST(DynamicBitsetQueries, FindRankSelect) {
+  s21::dynamic_bitset<> bits = RandomBits(5000, 4);
+  std::vector<size_t> ones;
+  for (size_t i = 0; i < bits.size(); ++i) {
+    if (bits[i]) {
+      ones.push_back(i);
+    }
+  }
+
+  size_t k = 0;
+  for (size_t pos = bits.find_first(); pos != bits.npos;
+       pos = bits.find_next(pos), ++k) {
+    ASSERT_LT(k, ones.size());
+    EXPECT_EQ(pos, ones[k]);
+  }
+  EXPECT_EQ(k, ones.size());
+
+  for (size_t i = 0; i < ones.size(); i += 37) {
+    EXPECT_EQ(bits.select(i), ones[i]);
+    EXPECT_EQ(bits.rank(ones[i]), i);
+    EXPECT_EQ(bits.rank(ones[i] + 1), i + 1);
+  }
+  EXPECT_EQ(bits.select(ones.size()), bits.npos);
+  EXPECT_EQ(bits.rank(bits.size()), ones.size());
+
+  s21::dynamic_bitset<> empty(70);
+  EXPECT_EQ(empty.find_first(), empty.npos);
+}
+
+TEST(DynamicBitsetQueries, CountLarge) {
+  s21::dynamic_bitset<> bits(1 << 20);
+  for (size_t i = 0; i < bits.size(); i += 3) {
+    bits.set(i);
+  }
+
+  EXPECT_EQ(bits.count(), ((1 << 20) + 2) / 3);
+}
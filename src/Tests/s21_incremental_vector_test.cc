@@ -0,0 +1,180 @@
+#include "../Containers/s21_incremental_vector.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+struct alignas(512) MoveCounter {
+  MoveCounter(int value = 0) : value(value) {}
+  MoveCounter(const MoveCounter &other) : value(other.value) { ++copies; }
+  MoveCounter(MoveCounter &&other) noexcept : value(other.value) { ++moves; }
+  MoveCounter &operator=(const MoveCounter &) = default;
+
+  int value;
+  static inline size_t moves = 0;
+  static inline size_t copies = 0;
+};
+
+// Counts live objects and throws once copies_left copies have been made.
+struct IncrementalThrowingCopy {
+  IncrementalThrowingCopy(int value, int *live, int *copies_left)
+      : value(value), live(live), copies_left(copies_left) {
+    ++*live;
+  }
+  IncrementalThrowingCopy(const IncrementalThrowingCopy &other)
+      : value(other.value), live(other.live), copies_left(other.copies_left) {
+    if ((*copies_left)-- == 0) {
+      throw std::runtime_error("copy");
+    }
+    ++*live;
+  }
+  ~IncrementalThrowingCopy() { --*live; }
+
+  int value;
+  int *live;
+  int *copies_left;
+};
+
+TEST(IncrementalVectorConstructors, Basic) {
+  s21::incremental_vector<int> s21_v_1;
+  s21::incremental_vector<int> s21_v_2(5);
+  s21::incremental_vector<int> s21_v_3 = {1, 2, 3};
+
+  EXPECT_TRUE(s21_v_1.empty());
+  EXPECT_EQ(s21_v_2.size(), 5);
+  EXPECT_EQ(s21_v_2[4], 0);
+  EXPECT_EQ(s21_v_3.back(), 3);
+}
+
+TEST(IncrementalVectorGrowth, OldAndNewBuffersCoexist) {
+  s21::incremental_vector<std::string> s21_v;
+  std::vector<std::string> std_v;
+
+  for (int i = 0; i < 1000; ++i) {
+    s21_v.push_back(std::to_string(i));
+    std_v.push_back(std::to_string(i));
+  }
+  s21_v.reserve(s21_v.size());
+  while (s21_v.size() < s21_v.capacity()) {
+    s21_v.push_back("fill");
+    std_v.push_back("fill");
+  }
+
+  s21_v.push_back("grown");
+  std_v.push_back("grown");
+
+  EXPECT_TRUE(s21_v.migrating());
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  for (size_t i = 0; i < std_v.size(); ++i) {
+    EXPECT_EQ(s21_v[i], std_v[i]);
+  }
+  EXPECT_EQ(s21_v.at(999), "999");
+  EXPECT_THROW(s21_v.at(s21_v.size()), std::out_of_range);
+
+  while (s21_v.migrating()) {
+    s21_v.push_back("more");
+    std_v.push_back("more");
+  }
+  EXPECT_TRUE(std::equal(std_v.begin(), std_v.end(), s21_v.begin()));
+}
+
+TEST(IncrementalVectorGrowth, BoundedWorkPerPush) {
+  s21::incremental_vector<MoveCounter> s21_v;
+  size_t max_moves = 0;
+
+  for (int i = 0; i < 20000; ++i) {
+    MoveCounter::moves = MoveCounter::copies = 0;
+    s21_v.push_back(MoveCounter(i));
+    max_moves = std::max(max_moves, MoveCounter::moves);
+  }
+
+  EXPECT_LE(max_moves,
+            s21::incremental_vector<MoveCounter>::kMigrationStep + 1);
+  for (int i = 0; i < 20000; i += 999) {
+    EXPECT_EQ(s21_v[i].value, i);
+  }
+}
+
+TEST(IncrementalVectorModifiers, PopBackDuringMigration) {
+  s21::incremental_vector<int> s21_v;
+  for (int i = 0; i < 4096; ++i) {
+    s21_v.push_back(i);
+  }
+  s21_v.push_back(4096);
+  ASSERT_TRUE(s21_v.migrating());
+
+  for (int i = 0; i < 3000; ++i) {
+    s21_v.pop_back();
+  }
+
+  EXPECT_EQ(s21_v.size(), 1097);
+  EXPECT_EQ(s21_v.back(), 1096);
+  EXPECT_FALSE(s21_v.migrating());
+  s21_v.push_back(7);
+  EXPECT_EQ(s21_v[1097], 7);
+}
+
+TEST(IncrementalVectorModifiers, InsertEraseData) {
+  s21::incremental_vector<int> s21_v;
+  std::vector<int> std_v;
+  for (int i = 0; i < 1025; ++i) {
+    s21_v.push_back(i);
+    std_v.push_back(i);
+  }
+
+  s21_v.insert(s21_v.begin() + 3, -1);
+  std_v.insert(std_v.begin() + 3, -1);
+  s21_v.erase(s21_v.begin() + 10);
+  std_v.erase(std_v.begin() + 10);
+
+  EXPECT_FALSE(s21_v.migrating());
+  EXPECT_TRUE(std::equal(std_v.begin(), std_v.end(), s21_v.data()));
+  EXPECT_THROW(s21_v.erase(s21_v.end()), std::out_of_range);
+}
+
+TEST(IncrementalVectorModifiers, CopyMoveSwapClear) {
+  s21::incremental_vector<std::string> s21_v_1;
+  for (int i = 0; i < 1025; ++i) {
+    s21_v_1.push_back(std::to_string(i));
+  }
+  ASSERT_TRUE(s21_v_1.migrating());
+
+  s21::incremental_vector<std::string> s21_v_2(s21_v_1);
+  s21::incremental_vector<std::string> s21_v_3(std::move(s21_v_1));
+  s21::incremental_vector<std::string> s21_v_4;
+  s21_v_4 = s21_v_3;
+  s21_v_4.swap(s21_v_1);
+
+  EXPECT_TRUE(s21_v_4.empty());
+  EXPECT_TRUE(s21_v_3.migrating());
+  EXPECT_EQ(s21_v_1.size(), 1025);
+  EXPECT_TRUE(std::equal(s21_v_1.begin(), s21_v_1.end(), s21_v_2.begin()));
+  EXPECT_TRUE(std::equal(s21_v_1.begin(), s21_v_1.end(), s21_v_3.begin()));
+
+  s21_v_3.clear();
+  EXPECT_FALSE(s21_v_3.migrating());
+  EXPECT_TRUE(s21_v_3.empty());
+  s21_v_3.shrink_to_fit();
+  EXPECT_EQ(s21_v_3.capacity(), 0);
+}
+
+TEST(IncrementalVectorGrowth, ThrowingReserveKeepsElements) {
+  int live = 0;
+  int copies_left = 100;
+  {
+    s21::incremental_vector<IncrementalThrowingCopy> s21_v;
+    s21_v.reserve(4);
+    for (int i = 0; i < 4; ++i) {
+      s21_v.push_back(IncrementalThrowingCopy(i, &live, &copies_left));
+    }
+
+    copies_left = 2;
+    EXPECT_THROW(s21_v.reserve(100), std::runtime_error);
+    EXPECT_EQ(s21_v.capacity(), 4);
+    EXPECT_EQ(live, 4);
+    EXPECT_EQ(s21_v[3].value, 3);
+  }
+  EXPECT_EQ(live, 0);
+}
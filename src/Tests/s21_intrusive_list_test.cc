@@ -0,0 +1,226 @@
+#include "../Containers/s21_intrusive_list.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+struct ByTimer;
+
+struct Connection : s21::intrusive_list_hook<>,
+                    s21::intrusive_list_hook<ByTimer> {
+  explicit Connection(int id = 0) : id(id) {}
+
+  bool operator<(const Connection& other) const { return id < other.id; }
+  bool operator==(const Connection& other) const { return id == other.id; }
+
+  int id;
+};
+
+using ConnectionList = s21::intrusive_list<Connection>;
+using TimerList = s21::intrusive_list<Connection, ByTimer>;
+
+template <typename List>
+std::vector<int> Ids(const List& list) {
+  std::vector<int> ids;
+  for (const Connection& connection : list) {
+    ids.push_back(connection.id);
+  }
+  return ids;
+}
+
+TEST(IntrusiveListModifiers, PushLinksObjectsInPlace) {
+  Connection a(1), b(2), c(3);
+  ConnectionList list;
+
+  list.push_back(b);
+  list.push_front(a);
+  list.insert(list.end(), c);
+
+  EXPECT_EQ(Ids(list), std::vector<int>({1, 2, 3}));
+  EXPECT_EQ(&list.front(), &a);
+  EXPECT_EQ(&*--list.end(), &c);
+  EXPECT_EQ(list.size(), 3);
+  EXPECT_TRUE(b.s21::intrusive_list_hook<>::is_linked());
+}
+
+TEST(IntrusiveListModifiers, InsertLinkedThrows) {
+  Connection a(1);
+  ConnectionList list_1;
+  ConnectionList list_2;
+
+  list_1.push_back(a);
+
+  EXPECT_THROW(list_2.push_back(a), std::invalid_argument);
+  EXPECT_THROW(list_1.erase(list_1.end()), std::invalid_argument);
+}
+
+TEST(IntrusiveListModifiers, EraseByReference) {
+  Connection a(1), b(2), c(3);
+  ConnectionList list;
+  list.push_back(a);
+  list.push_back(b);
+  list.push_back(c);
+
+  list.erase(b);
+  list.pop_front();
+
+  EXPECT_EQ(Ids(list), std::vector<int>({3}));
+  EXPECT_FALSE(a.s21::intrusive_list_hook<>::is_linked());
+  EXPECT_FALSE(b.s21::intrusive_list_hook<>::is_linked());
+}
+
+TEST(IntrusiveListModifiers, DestroyedObjectsUnlinkThemselves) {
+  ConnectionList list;
+  Connection first(1);
+  list.push_back(first);
+  {
+    auto second = std::make_unique<Connection>(2);
+    list.push_back(*second);
+    Connection third(3);
+    list.push_back(third);
+    EXPECT_EQ(list.size(), 3);
+  }
+
+  EXPECT_EQ(Ids(list), std::vector<int>({1}));
+  EXPECT_EQ(&list.back(), &first);
+}
+
+TEST(IntrusiveListModifiers, ListOutlivedByElements) {
+  Connection a(1), b(2);
+  {
+    ConnectionList list;
+    list.push_back(a);
+    list.push_back(b);
+  }
+
+  EXPECT_FALSE(a.s21::intrusive_list_hook<>::is_linked());
+  EXPECT_FALSE(b.s21::intrusive_list_hook<>::is_linked());
+}
+
+TEST(IntrusiveListModifiers, CopiesStartUnlinked) {
+  Connection a(1);
+  ConnectionList list;
+  list.push_back(a);
+
+  Connection copy(a);
+  list.push_back(copy);
+
+  EXPECT_EQ(Ids(list), std::vector<int>({1, 1}));
+}
+
+TEST(IntrusiveListModifiers, MoveAndSwap) {
+  Connection a(1), b(2), c(3);
+  ConnectionList list_1;
+  list_1.push_back(a);
+  list_1.push_back(b);
+  ConnectionList list_2;
+  list_2.push_back(c);
+
+  list_1.swap(list_2);
+  ConnectionList list_3(std::move(list_2));
+
+  EXPECT_EQ(Ids(list_1), std::vector<int>({3}));
+  EXPECT_TRUE(list_2.empty());
+  EXPECT_EQ(Ids(list_3), std::vector<int>({1, 2}));
+}
+
+TEST(IntrusiveListModifiers, SeveralHooksPerObject) {
+  Connection a(1), b(2);
+  ConnectionList connections;
+  TimerList timers;
+
+  connections.push_back(a);
+  connections.push_back(b);
+  timers.push_back(b);
+  timers.push_back(a);
+  timers.erase(b);
+
+  EXPECT_EQ(Ids(connections), std::vector<int>({1, 2}));
+  EXPECT_EQ(Ids(timers), std::vector<int>({1}));
+}
+
+TEST(IntrusiveListOperations, Splice) {
+  std::vector<Connection> pool;
+  for (int i = 0; i < 8; ++i) {
+    pool.emplace_back(i);
+  }
+  ConnectionList list_1;
+  ConnectionList list_2;
+  for (int i = 0; i < 4; ++i) {
+    list_1.push_back(pool[i]);
+    list_2.push_back(pool[i + 4]);
+  }
+
+  list_1.splice(list_1.begin(), list_2, ConnectionList::iterator_to(pool[5]));
+  list_1.splice(list_1.end(), list_2, list_2.begin(), --list_2.end());
+  list_1.splice(std::next(list_1.begin()), list_2);
+
+  EXPECT_EQ(Ids(list_1), std::vector<int>({5, 7, 0, 1, 2, 3, 4, 6}));
+  EXPECT_TRUE(list_2.empty());
+}
+
+TEST(IntrusiveListOperations, SortMergeReverseUnique) {
+  std::vector<Connection> pool;
+  for (int id : {5, 1, 4, 1, 3, 9, 2, 6}) {
+    pool.emplace_back(id);
+  }
+  ConnectionList list_1;
+  ConnectionList list_2;
+  for (size_t i = 0; i < pool.size(); ++i) {
+    (i % 2 ? list_2 : list_1).push_back(pool[i]);
+  }
+
+  list_1.sort();
+  list_2.sort();
+  list_1.merge(list_2);
+  EXPECT_EQ(Ids(list_1), std::vector<int>({1, 1, 2, 3, 4, 5, 6, 9}));
+  EXPECT_TRUE(list_2.empty());
+
+  list_1.unique();
+  list_1.reverse();
+  EXPECT_EQ(Ids(list_1), std::vector<int>({9, 6, 5, 4, 3, 2, 1}));
+  EXPECT_EQ(list_1.size(), 7);
+  EXPECT_FALSE(pool[3].s21::intrusive_list_hook<>::is_linked());
+}
+
+TEST(IntrusiveListOperations, ThrowingComparatorKeepsElements) {
+  std::vector<Connection> pool;
+  for (int id : {5, 4, 3, 2, 1, 0, 6, 7}) {
+    pool.emplace_back(id);
+  }
+  ConnectionList list_1;
+  ConnectionList list_2;
+  for (size_t i = 0; i < pool.size(); ++i) {
+    (i < 6 ? list_1 : list_2).push_back(pool[i]);
+  }
+  int calls = 0;
+  auto comp = [&calls](const Connection& a, const Connection& b) {
+    if (++calls % 4 == 0) {
+      throw std::runtime_error("compare");
+    }
+    return a < b;
+  };
+
+  EXPECT_THROW(list_1.sort(comp), std::runtime_error);
+  EXPECT_EQ(list_1.size(), 6);
+  calls = 2;
+  EXPECT_THROW(list_1.merge(list_2, comp), std::runtime_error);
+
+  std::vector<int> ids = Ids(list_1);
+  std::sort(ids.begin(), ids.end());
+  EXPECT_EQ(ids, std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7}));
+  size_t backward = 0;
+  for (auto it = list_1.end(); it != list_1.begin(); --it) {
+    ++backward;
+  }
+  EXPECT_EQ(backward, 8);
+  EXPECT_TRUE(list_2.empty());
+
+  list_1.sort();
+  EXPECT_EQ(Ids(list_1), std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7}));
+}
@@ -2,7 +2,48 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <functional>
+#include <iterator>
 #include <list>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+template <typename T>
+struct ListCountingAllocator {
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::false_type;
+  using propagate_on_container_swap = std::true_type;
+
+  explicit ListCountingAllocator(int* live) noexcept : live(live) {}
+  template <typename U>
+  ListCountingAllocator(const ListCountingAllocator<U>& other) noexcept
+      : live(other.live) {}
+
+  T* allocate(size_t n) {
+    ++*live;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* p, size_t n) noexcept {
+    --*live;
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  template <typename U>
+  bool operator==(const ListCountingAllocator<U>& rhs) const noexcept {
+    return live == rhs.live;
+  }
+  template <typename U>
+  bool operator!=(const ListCountingAllocator<U>& rhs) const noexcept {
+    return live != rhs.live;
+  }
+
+  int* live;
+};
 
 template <typename value_type>
 bool CompareLists(s21::list<value_type> my_list,
@@ -162,7 +203,50 @@ TEST(ListIterators, End) {
   s21::list<int> my_list = {500, 15000, 3};
   std::list<int> std_list = {500, 15000, 3};
 
-  EXPECT_EQ(*my_list.end(), *std_list.end());
+  EXPECT_EQ(*--my_list.end(), *--std_list.end());
+}
+
+TEST(ListIterators, EndIsPastTheEnd) {
+  s21::list<int> my_list = {4, 8, 15, 16, 23, 42};
+
+  EXPECT_EQ(std::distance(my_list.begin(), my_list.end()), 6);
+  EXPECT_EQ(std::accumulate(my_list.begin(), my_list.end(), 0), 108);
+  EXPECT_EQ(*std::find(my_list.begin(), my_list.end(), 42), 42);
+  EXPECT_EQ(std::find(my_list.begin(), my_list.end(), 7), my_list.end());
+}
+
+TEST(ListIterators, EmptyBeginIsEnd) {
+  s21::list<int> my_list;
+
+  EXPECT_EQ(my_list.begin(), my_list.end());
+  my_list.push_back(1);
+  my_list.pop_front();
+  EXPECT_EQ(my_list.begin(), my_list.end());
+}
+
+TEST(ListIterators, Backwards) {
+  s21::list<int> my_list = {1, 2, 3};
+  std::vector<int> seen;
+
+  for (auto it = my_list.end(); it != my_list.begin();) {
+    seen.push_back(*--it);
+  }
+
+  EXPECT_EQ(seen, std::vector<int>({3, 2, 1}));
+}
+
+TEST(ListIterators, PostfixReturnsPreviousPosition) {
+  s21::list<int> my_list = {1, 2, 3};
+  auto it = my_list.begin();
+
+  EXPECT_EQ(*it++, 1);
+  EXPECT_EQ(*it, 2);
+  EXPECT_EQ(*it--, 2);
+  EXPECT_EQ(*it, 1);
+
+  std::vector<int> seen;
+  std::copy(my_list.begin(), my_list.end(), std::back_inserter(seen));
+  EXPECT_EQ(seen, std::vector<int>({1, 2, 3}));
 }
 
 TEST(ListCapacity, Empty) {
@@ -226,7 +310,7 @@ TEST(ListModifiers, InsertBegin) {
 
 TEST(ListModifiers, InsertMiddle) {
   s21::list<int> my_list = {1, 9999, 20000};
-  my_list.insert(my_list.begin()++, 5);
+  my_list.insert(++my_list.begin(), 5);
 
   std::list<int> std_list = {1, 9999, 20000};
   std_list.insert(std_list.begin().operator++(), 5);
@@ -244,6 +328,45 @@ TEST(ListModifiers, InsertEnd) {
   EXPECT_TRUE(CompareLists(my_list, std_list));
 }
 
+TEST(ListModifiers, InsertBeforeLast) {
+  s21::list<int> my_list = {1, 2, 3};
+  auto it = my_list.insert(--my_list.end(), 5);
+
+  std::list<int> std_list = {1, 2, 5, 3};
+  EXPECT_TRUE(CompareLists(my_list, std_list));
+  EXPECT_EQ(*it, 5);
+  EXPECT_EQ(my_list.back(), 3);
+}
+
+TEST(ListModifiers, EraseLast) {
+  s21::list<int> my_list = {1, 2, 3};
+  my_list.erase(--my_list.end());
+
+  std::list<int> std_list = {1, 2};
+  EXPECT_TRUE(CompareLists(my_list, std_list));
+  EXPECT_EQ(my_list.back(), 2);
+}
+
+TEST(ListModifiers, SwapAndMoveKeepRings) {
+  s21::list<int> my_list1 = {1, 2, 3};
+  s21::list<int> my_list2;
+
+  my_list1.swap(my_list2);
+  EXPECT_EQ(my_list1.begin(), my_list1.end());
+  EXPECT_EQ(std::distance(my_list2.begin(), my_list2.end()), 3);
+  EXPECT_EQ(*--my_list2.end(), 3);
+
+  s21::list<int> my_list3(std::move(my_list2));
+  EXPECT_EQ(my_list2.begin(), my_list2.end());
+  EXPECT_EQ(*--my_list3.end(), 3);
+
+  my_list3.push_back(4);
+  my_list2.push_back(9);
+  std::list<int> std_list = {1, 2, 3, 4};
+  EXPECT_TRUE(CompareLists(my_list3, std_list));
+  EXPECT_EQ(my_list2.front(), 9);
+}
+
 TEST(ListModifiers, EraseBegin) {
   s21::list<int> my_list = {1, 9999, 20000};
   my_list.erase(my_list.begin());
@@ -256,7 +379,7 @@ TEST(ListModifiers, EraseBegin) {
 
 TEST(ListModifiers, EraseMiddle) {
   s21::list<int> my_list = {1, 9999, 20000};
-  my_list.erase(my_list.begin()++);
+  my_list.erase(++my_list.begin());
 
   std::list<int> std_list = {1, 9999, 20000};
   std_list.erase(std_list.begin().operator++());
@@ -270,6 +393,50 @@ TEST(ListModifiers, EraseThrow) {
   EXPECT_THROW(my_list.erase(my_list.end()), std::invalid_argument);
 }
 
+TEST(ListModifiers, EmplaceConstructsInPlace) {
+  s21::list<std::pair<std::string, int>> my_list;
+
+  auto& back = my_list.emplace_back("b", 2);
+  auto& front = my_list.emplace_front("a", 1);
+  auto it = my_list.emplace(--my_list.end(), std::string(3, 'x'), 3);
+
+  EXPECT_EQ(back.first, "b");
+  EXPECT_EQ(front.second, 1);
+  EXPECT_EQ(it->first, "xxx");
+  EXPECT_EQ(*++my_list.begin(), std::make_pair(std::string("xxx"), 3));
+  EXPECT_EQ(my_list.back().second, 2);
+  EXPECT_EQ(my_list.size(), 3);
+}
+
+TEST(ListModifiers, MoveOnlyElements) {
+  s21::list<std::unique_ptr<int>> my_list;
+
+  my_list.push_back(std::make_unique<int>(2));
+  my_list.push_front(std::make_unique<int>(1));
+  my_list.insert(my_list.end(), std::make_unique<int>(3));
+  my_list.emplace_back(new int(4));
+
+  s21::list<std::unique_ptr<int>> moved(std::move(my_list));
+  int sum = 0;
+  for (const auto& item : moved) {
+    sum += *item;
+  }
+
+  EXPECT_EQ(sum, 10);
+  EXPECT_EQ(*moved.front(), 1);
+  EXPECT_TRUE(my_list.empty());
+}
+
+TEST(ListModifiers, RvalueInsertDoesNotCopy) {
+  std::string payload(1000, 'p');
+  const char* buffer = payload.data();
+  s21::list<std::string> my_list;
+
+  my_list.push_back(std::move(payload));
+
+  EXPECT_EQ(my_list.front().data(), buffer);
+}
+
 TEST(ListModifiers, PushBack) {
   s21::list<int> my_list = {1, 2, 3, 4, 5};
   my_list.push_back(6);
@@ -404,6 +571,128 @@ TEST(ListOperations, SpliceBothEmpty) {
   EXPECT_TRUE(CompareLists(my_list1, std_list1));
 }
 
+TEST(ListOperations, MergeRelinksNodes) {
+  s21::list<std::string> my_list1 = {"a", "c", "e"};
+  s21::list<std::string> my_list2 = {"b", "c", "d", "f", "g"};
+  const std::string* c_from_other = &*++my_list2.begin();
+
+  my_list1.merge(my_list2);
+
+  std::list<std::string> std_list = {"a", "b", "c", "c", "d", "e", "f", "g"};
+  EXPECT_TRUE(CompareLists(my_list1, std_list));
+  EXPECT_TRUE(my_list2.empty());
+  EXPECT_EQ(&*++++++my_list1.begin(), c_from_other);
+  EXPECT_EQ(my_list1.back(), "g");
+}
+
+// Elements in both directions, sorted, so that a list that lost or
+// duplicated nodes or broke its prev links shows up.
+template <typename List>
+std::vector<int> SortedBothWays(List &list) {
+  std::vector<int> forward(list.begin(), list.end());
+  std::vector<int> backward;
+  for (auto it = list.end(); it != list.begin();) {
+    backward.push_back(*--it);
+  }
+
+  std::sort(forward.begin(), forward.end());
+  std::sort(backward.begin(), backward.end());
+  EXPECT_EQ(forward, backward);
+  return forward;
+}
+
+TEST(ListOperations, MergeThrowingComparatorKeepsNodes) {
+  s21::list<int> my_list_1 = {1, 3, 5};
+  s21::list<int> my_list_2 = {2, 4, 6};
+  int calls = 0;
+  auto comp = [&calls](int a, int b) {
+    if (++calls == 2) {
+      throw std::runtime_error("compare");
+    }
+    return a < b;
+  };
+
+  EXPECT_THROW(my_list_1.merge(my_list_2, comp), std::runtime_error);
+
+  EXPECT_EQ(my_list_1.size(), 6);
+  EXPECT_EQ(SortedBothWays(my_list_1), std::vector<int>({1, 2, 3, 4, 5, 6}));
+  EXPECT_TRUE(my_list_2.empty());
+  my_list_2.push_back(7);
+  EXPECT_EQ(my_list_2.front(), 7);
+}
+
+TEST(ListOperations, MergeWithComparator) {
+  s21::list<int> my_list1 = {9, 5, 1};
+  s21::list<int> my_list2 = {8, 5, 2, 0};
+  std::list<int> std_list1 = {9, 5, 1};
+  std::list<int> std_list2 = {8, 5, 2, 0};
+
+  my_list1.merge(my_list2, std::greater<>());
+  std_list1.merge(std_list2, std::greater<>());
+
+  EXPECT_TRUE(CompareLists(my_list1, std_list1));
+  EXPECT_EQ(my_list1.back(), 0);
+}
+
+TEST(ListOperations, SpliceMiddleKeepsNodes) {
+  s21::list<int> my_list1 = {1, 2, 3};
+  s21::list<int> my_list2 = {10, 20};
+  const int* ten = &my_list2.front();
+
+  my_list1.splice(++my_list1.begin(), my_list2);
+
+  std::list<int> std_list = {1, 10, 20, 2, 3};
+  EXPECT_TRUE(CompareLists(my_list1, std_list));
+  EXPECT_EQ(&*++my_list1.begin(), ten);
+  EXPECT_TRUE(my_list2.empty());
+}
+
+TEST(ListOperations, SpliceSingle) {
+  s21::list<int> my_list1 = {1, 2, 3};
+  s21::list<int> my_list2 = {10, 20, 30};
+
+  my_list1.splice(my_list1.begin(), my_list2, ++my_list2.begin());
+  my_list1.splice(++my_list1.begin(), my_list1, ++++my_list1.begin());
+
+  std::list<int> std_list1 = {20, 2, 1, 3};
+  std::list<int> std_list2 = {10, 30};
+  EXPECT_TRUE(CompareLists(my_list1, std_list1));
+  EXPECT_TRUE(CompareLists(my_list2, std_list2));
+  EXPECT_EQ(my_list1.back(), 3);
+  EXPECT_EQ(my_list2.back(), 30);
+}
+
+TEST(ListOperations, SpliceRange) {
+  s21::list<int> my_list1 = {1, 2, 3};
+  s21::list<int> my_list2 = {10, 20, 30, 40, 50};
+
+  auto first = ++my_list2.begin();
+  auto last = ++++++my_list2.begin();
+  my_list1.splice(++my_list1.begin(), my_list2, first, last);
+
+  std::list<int> std_list1 = {1, 20, 30, 2, 3};
+  std::list<int> std_list2 = {10, 40, 50};
+  EXPECT_TRUE(CompareLists(my_list1, std_list1));
+  EXPECT_TRUE(CompareLists(my_list2, std_list2));
+  EXPECT_EQ(my_list1.size(), 5);
+  EXPECT_EQ(my_list2.size(), 3);
+}
+
+TEST(ListOperations, SpliceRangeToEnd) {
+  s21::list<int> my_list1 = {1, 2};
+  s21::list<int> my_list2 = {10, 20, 30};
+
+  my_list1.splice(my_list1.end(), my_list2, ++my_list2.begin(),
+                  my_list2.end());
+
+  std::list<int> std_list1 = {1, 2, 20, 30};
+  std::list<int> std_list2 = {10};
+  EXPECT_TRUE(CompareLists(my_list1, std_list1));
+  EXPECT_TRUE(CompareLists(my_list2, std_list2));
+  EXPECT_EQ(my_list1.back(), 30);
+  EXPECT_EQ(my_list2.back(), 10);
+}
+
 TEST(ListOperations, ReverseInitList) {
   s21::list<int> my_list = {1, 2, 3, 4, 5};
   std::list<int> std_list = {1, 2, 3, 4, 5};
@@ -449,6 +738,57 @@ TEST(ListOperations, Unique) {
   EXPECT_TRUE(CompareLists(my_list, std_list));
 }
 
+TEST(ListOperations, UniqueWithPredicate) {
+  s21::list<int> my_list = {1, 2, 4, 5, 7, 9, 10, 11, 12, 20};
+  std::list<int> std_list = {1, 2, 4, 5, 7, 9, 10, 11, 12, 20};
+  auto close = [](int kept, int value) { return value - kept < 3; };
+
+  EXPECT_EQ(my_list.unique(close), 5);
+  std_list.unique(close);
+
+  EXPECT_TRUE(CompareLists(my_list, std_list));
+  EXPECT_EQ(my_list.unique(), 0);
+}
+
+TEST(ListOperations, RemoveAndRemoveIf) {
+  s21::list<int> my_list = {3, 1, 3, 4, 3, 5, 9, 2, 6, 3};
+  std::list<int> std_list = {3, 1, 3, 4, 3, 5, 9, 2, 6, 3};
+
+  EXPECT_EQ(my_list.remove(3), 4);
+  std_list.remove(3);
+  EXPECT_TRUE(CompareLists(my_list, std_list));
+
+  auto even = [](int value) { return value % 2 == 0; };
+  EXPECT_EQ(my_list.remove_if(even), 3);
+  std_list.remove_if(even);
+  EXPECT_TRUE(CompareLists(my_list, std_list));
+  EXPECT_EQ(my_list.remove(7), 0);
+}
+
+TEST(ListOperations, RemoveElementOfTheList) {
+  s21::list<std::string> my_list = {"a", "b", "a", "c", "a"};
+
+  EXPECT_EQ(my_list.remove(my_list.front()), 3);
+  EXPECT_EQ(my_list.size(), 2);
+  EXPECT_EQ(my_list.front(), "b");
+  EXPECT_EQ(my_list.back(), "c");
+}
+
+TEST(ListOperations, RemoveIfThrowingPredicate) {
+  s21::list<int> my_list = {1, 2, 3, 4};
+
+  EXPECT_THROW(my_list.remove_if([](int value) {
+    if (value == 3) {
+      throw std::runtime_error("predicate");
+    }
+    return value == 2;
+  }),
+               std::runtime_error);
+
+  EXPECT_EQ(my_list.size(), 3);
+  EXPECT_EQ(*std::next(my_list.begin()), 3);
+}
+
 TEST(ListOperations, Sort) {
   s21::list<int> my_list = {1, 2, 3, 2, 1};
   std::list<int> std_list = {1, 2, 3, 2, 1};
@@ -465,4 +805,230 @@ TEST(ListOperations, SortZeroSize) {
   std_list.sort();
 
   EXPECT_TRUE(CompareLists(my_list, std_list));
-}
\ No newline at end of file
+}
+
+TEST(ListOperations, SortLarge) {
+  s21::list<int> my_list;
+  std::list<int> std_list;
+  unsigned state = 12345;
+  for (int i = 0; i < 100001; ++i) {
+    state = state * 1103515245 + 12345;
+    my_list.push_back(static_cast<int>(state >> 8));
+    std_list.push_back(static_cast<int>(state >> 8));
+  }
+
+  my_list.sort();
+  std_list.sort();
+
+  EXPECT_TRUE(CompareLists(my_list, std_list));
+  EXPECT_EQ(my_list.back(), std_list.back());
+}
+
+TEST(ListOperations, SortThrowingComparatorKeepsNodes) {
+  s21::list<int> my_list = {5, 4, 3, 2, 1, 0};
+  int calls = 0;
+  auto comp = [&calls](int a, int b) {
+    if (++calls == 4) {
+      throw std::runtime_error("compare");
+    }
+    return a < b;
+  };
+
+  EXPECT_THROW(my_list.sort(comp), std::runtime_error);
+
+  EXPECT_EQ(my_list.size(), 6);
+  EXPECT_EQ(SortedBothWays(my_list), std::vector<int>({0, 1, 2, 3, 4, 5}));
+  my_list.sort();
+  EXPECT_EQ(my_list.front(), 0);
+  EXPECT_EQ(my_list.back(), 5);
+}
+
+TEST(ListOperations, SortStableWithComparator) {
+  s21::list<std::pair<int, int>> my_list;
+  std::list<std::pair<int, int>> std_list;
+  for (int i = 0; i < 1000; ++i) {
+    my_list.push_back({i % 7, i});
+    std_list.push_back({i % 7, i});
+  }
+  auto by_key = [](const auto& a, const auto& b) { return a.first > b.first; };
+
+  my_list.sort(by_key);
+  std_list.sort(by_key);
+
+  EXPECT_TRUE(CompareLists(my_list, std_list));
+}
+
+TEST(ListOperations, SortRelinksNodes) {
+  s21::list<std::string> my_list = {"delta", "alpha", "charlie", "bravo"};
+  const std::string* alpha = &*++my_list.begin();
+
+  my_list.sort();
+
+  EXPECT_EQ(&my_list.front(), alpha);
+  EXPECT_EQ(my_list.back(), "delta");
+  EXPECT_EQ(my_list.size(), 4);
+}
+TEST(ListAllocator, NodesGoThroughAllocator) {
+  int live = 0;
+  {
+    ListCountingAllocator<std::string> alloc(&live);
+    s21::list<std::string, ListCountingAllocator<std::string>> my_list(alloc);
+
+    my_list.push_back("b");
+    my_list.push_front("a");
+    my_list.insert(my_list.end(), "c");
+    EXPECT_EQ(live, 3);
+
+    my_list.pop_front();
+    EXPECT_EQ(live, 2);
+  }
+  EXPECT_EQ(live, 0);
+}
+
+TEST(ListAllocator, Propagation) {
+  int live_1 = 0;
+  int live_2 = 0;
+  using Alloc = ListCountingAllocator<int>;
+  {
+    s21::list<int, Alloc> my_list_1({1, 2, 3}, Alloc(&live_1));
+    s21::list<int, Alloc> my_list_2({4, 5}, Alloc(&live_2));
+
+    my_list_2 = my_list_1;
+    EXPECT_EQ(live_1, 6);
+    EXPECT_EQ(live_2, 0);
+
+    s21::list<int, Alloc> my_list_3({7}, Alloc(&live_2));
+    my_list_1 = std::move(my_list_3);
+    EXPECT_EQ(my_list_1.front(), 7);
+    EXPECT_EQ(live_1, 4);
+    EXPECT_EQ(live_2, 0);
+
+    my_list_1.swap(my_list_2);
+    EXPECT_TRUE(my_list_2.get_allocator() == Alloc(&live_1));
+  }
+  EXPECT_EQ(live_1, 0);
+  EXPECT_EQ(live_2, 0);
+}
+
+TEST(ListOperations, CompactLaysOutNodesInOrder) {
+  s21::list<int> my_list;
+  std::list<int> std_list;
+  for (int i = 0; i < 200; ++i) {
+    my_list.push_front(i);
+    std_list.push_front(i);
+  }
+  for (auto it = my_list.begin(); it != my_list.end();) {
+    auto next = std::next(it);
+    if (*it % 3 == 0) {
+      my_list.erase(it);
+    }
+    it = next;
+  }
+  std_list.remove_if([](int value) { return value % 3 == 0; });
+  my_list.sort();
+  std_list.sort();
+
+  my_list.compact();
+
+  EXPECT_TRUE(CompareLists(my_list, std_list));
+  const int* first = &my_list.front();
+  const int* second = &*++my_list.begin();
+  std::ptrdiff_t stride = second - first;
+  bool sequential = true;
+  const int* expected = first;
+  for (const int& value : my_list) {
+    sequential = sequential && &value == expected;
+    expected += stride;
+  }
+  EXPECT_TRUE(sequential);
+  EXPECT_EQ(*--my_list.end(), 199);
+}
+
+TEST(ListOperations, CompactedNodesStayUsable) {
+  s21::list<std::string> my_list = {"a", "b", "c", "d", "e"};
+  my_list.compact();
+
+  my_list.erase(++my_list.begin());
+  my_list.push_back("f");
+  my_list.push_front("z");
+  my_list.sort();
+  my_list.compact();
+  my_list.pop_front();
+
+  std::list<std::string> std_list = {"c", "d", "e", "f", "z"};
+  EXPECT_TRUE(CompareLists(my_list, std_list));
+}
+
+TEST(ListAllocator, CompactedBlockReleasedOnClear) {
+  int live = 0;
+  using Alloc = ListCountingAllocator<int>;
+  {
+    s21::list<int, Alloc> my_list({1, 2, 3, 4}, Alloc(&live));
+    EXPECT_EQ(live, 4);
+
+    my_list.compact();
+    EXPECT_EQ(live, 3);
+    my_list.compact();
+    EXPECT_EQ(live, 3);
+
+    my_list.pop_back();
+    my_list.pop_back();
+    my_list.push_back(5);
+    EXPECT_EQ(live, 4);
+    my_list.pop_back();
+    EXPECT_EQ(live, 3);
+
+    my_list.clear();
+    EXPECT_EQ(live, 0);
+    my_list.push_back(6);
+    my_list.pop_back();
+    my_list.compact();
+    EXPECT_EQ(live, 0);
+  }
+  EXPECT_EQ(live, 0);
+}
+
+TEST(ListAllocator, RemovedNodesAreFreed) {
+  int live = 0;
+  using Alloc = ListCountingAllocator<int>;
+  {
+    s21::list<int, Alloc> my_list({1, 1, 2, 2, 2, 3, 4, 4}, Alloc(&live));
+
+    EXPECT_EQ(my_list.unique(), 4);
+    EXPECT_EQ(live, 4);
+    EXPECT_EQ(my_list.remove(3), 1);
+    EXPECT_EQ(my_list.remove_if([](int value) { return value > 1; }), 2);
+    EXPECT_EQ(live, 1);
+  }
+  EXPECT_EQ(live, 0);
+}
+
+TEST(ListAllocator, CompactedNodesSplicedAcrossLists) {
+  int live = 0;
+  using Alloc = ListCountingAllocator<int>;
+  {
+    s21::list<int, Alloc> my_list_1({1, 2, 3}, Alloc(&live));
+    s21::list<int, Alloc> my_list_2({7, 8}, Alloc(&live));
+    Alloc alloc(&live);
+    s21::list<int, Alloc> my_list_3(alloc);
+    my_list_1.compact();
+    my_list_2.compact();
+
+    my_list_3.splice(my_list_3.end(), my_list_1, ++my_list_1.begin());
+    my_list_3.splice(my_list_3.end(), my_list_2, my_list_2.begin());
+    my_list_1.clear();
+    my_list_2.clear();
+
+    EXPECT_EQ(my_list_3.front(), 2);
+    EXPECT_EQ(my_list_3.back(), 7);
+    EXPECT_EQ(my_list_3.size(), 2);
+    EXPECT_EQ(live, 6);
+    my_list_3.merge(my_list_1);
+    my_list_3.pop_front();
+    EXPECT_EQ(live, 6);
+    my_list_3.compact();
+    EXPECT_EQ(my_list_3.front(), 7);
+    EXPECT_EQ(live, 3);
+  }
+  EXPECT_EQ(live, 0);
+}
@@ -0,0 +1,180 @@
+#include "../Containers/s21_lock_free_list.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+template <typename List>
+std::vector<typename List::value_type> Elements(const List& list) {
+  std::vector<typename List::value_type> elements;
+  list.for_each([&elements](const typename List::value_type& value) {
+    elements.push_back(value);
+  });
+  return elements;
+}
+
+struct Counted {
+  explicit Counted(int key, std::atomic<int>* live) : key(key), live(live) {
+    ++*live;
+  }
+  Counted(const Counted& other) : key(other.key), live(other.live) {
+    ++*live;
+  }
+  ~Counted() { --*live; }
+
+  bool operator<(const Counted& other) const { return key < other.key; }
+
+  int key;
+  std::atomic<int>* live;
+};
+
+TEST(LockFreeListModifiers, InsertKeepsKeysSortedAndUnique) {
+  s21::lock_free_list<int> list;
+
+  EXPECT_TRUE(list.empty());
+  for (int key : {5, 1, 4, 1, 3, 5, 2}) {
+    list.insert(key);
+  }
+
+  EXPECT_EQ(Elements(list), std::vector<int>({1, 2, 3, 4, 5}));
+  EXPECT_EQ(list.size(), 5);
+  EXPECT_FALSE(list.insert(3));
+  EXPECT_TRUE(list.contains(4));
+  EXPECT_FALSE(list.contains(6));
+}
+
+TEST(LockFreeListModifiers, EraseRemovesOnlyPresentKeys) {
+  s21::lock_free_list<std::string> list;
+  list.insert("b");
+  list.emplace(2, 'a');
+  list.insert(std::string("c"));
+
+  EXPECT_TRUE(list.erase("b"));
+  EXPECT_FALSE(list.erase("b"));
+  EXPECT_FALSE(list.erase("z"));
+  EXPECT_FALSE(list.contains("b"));
+  EXPECT_EQ(Elements(list), std::vector<std::string>({"aa", "c"}));
+  EXPECT_EQ(list.size(), 2);
+}
+
+TEST(LockFreeListModifiers, CustomComparator) {
+  s21::lock_free_list<int, std::greater<int>> list;
+  for (int key = 0; key < 5; ++key) {
+    list.insert(key);
+  }
+
+  EXPECT_EQ(Elements(list), std::vector<int>({4, 3, 2, 1, 0}));
+}
+
+TEST(LockFreeListModifiers, ErasedAndRemainingNodesAreFreed) {
+  std::atomic<int> live{0};
+  {
+    s21::lock_free_list<Counted> list;
+    for (int key = 0; key < 1000; ++key) {
+      list.emplace(key, &live);
+    }
+    for (int key = 0; key < 1000; key += 2) {
+      EXPECT_TRUE(list.erase(Counted(key, &live)));
+    }
+    EXPECT_EQ(list.size(), 500);
+  }
+
+  EXPECT_EQ(live, 0);
+}
+
+TEST(LockFreeListIterators, SnapshotSkipsErasedNodes) {
+  s21::lock_free_list<int> list;
+  for (int key = 0; key < 6; ++key) {
+    list.insert(key);
+  }
+
+  auto view = list.snapshot();
+  auto it = view.begin();
+  list.erase(1);
+  list.erase(2);
+
+  EXPECT_EQ(*it, 0);
+  EXPECT_EQ(*++it, 3);
+  std::vector<int> rest(it, view.end());
+  EXPECT_EQ(rest, std::vector<int>({3, 4, 5}));
+}
+
+TEST(LockFreeListConcurrency, DisjointInsertErase) {
+  constexpr int kThreads = 8;
+  constexpr int kKeys = 2000;
+  s21::lock_free_list<int> list;
+  std::vector<std::thread> threads;
+
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&list, t] {
+      for (int i = 0; i < kKeys; ++i) {
+        list.insert(i * kThreads + t);
+      }
+      for (int i = 0; i < kKeys; i += 2) {
+        list.erase(i * kThreads + t);
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  std::vector<int> elements = Elements(list);
+  ASSERT_EQ(elements.size(), static_cast<size_t>(kThreads * kKeys / 2));
+  EXPECT_TRUE(std::is_sorted(elements.begin(), elements.end()));
+  for (int key : elements) {
+    EXPECT_EQ(key / kThreads % 2, 1);
+  }
+}
+
+TEST(LockFreeListConcurrency, ContendedKeysWithReaders) {
+  constexpr int kThreads = 8;
+  constexpr int kRounds = 20000;
+  constexpr int kKeys = 64;
+  std::atomic<int> live{0};
+  std::atomic<int> balance{0};
+  std::atomic<bool> done{false};
+  {
+    s21::lock_free_list<Counted> list;
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < kThreads; ++t) {
+      threads.emplace_back([&, t] {
+        for (int i = 0; i < kRounds; ++i) {
+          int key = (i * 7 + t) % kKeys;
+          if ((i + t) % 2) {
+            balance += list.emplace(key, &live);
+          } else {
+            balance -= list.erase(Counted(key, &live));
+          }
+        }
+      });
+    }
+    std::thread reader([&] {
+      while (!done) {
+        int previous = -1;
+        list.for_each([&previous](const Counted& value) {
+          EXPECT_LT(previous, value.key);
+          previous = value.key;
+        });
+      }
+    });
+
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+    done = true;
+    reader.join();
+
+    EXPECT_EQ(static_cast<int>(list.size()), balance);
+    EXPECT_EQ(static_cast<int>(Elements(list).size()), balance);
+  }
+
+  EXPECT_EQ(live, 0);
+}
@@ -0,0 +1,172 @@
+#include "../Containers/s21_mapped_vector.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+struct Record {
+  int id;
+  double score;
+};
+
+static std::string MappedPath(const std::string &name) {
+  std::string path = testing::TempDir() + "s21_mapped_vector_" + name;
+  std::remove(path.c_str());
+  return path;
+}
+
+TEST(MappedVectorConstructors, CreatesEmptyFile) {
+  std::string path = MappedPath("empty");
+  s21::mapped_vector<int> s21_v(path);
+
+  EXPECT_TRUE(s21_v.empty());
+  EXPECT_EQ(s21_v.size(), 0);
+  EXPECT_FALSE(s21_v.read_only());
+  EXPECT_NE(s21_v.data(), nullptr);
+
+  std::remove(path.c_str());
+}
+
+TEST(MappedVectorConstructors, ReadOnlyMissingFileThrows) {
+  std::string path = MappedPath("missing");
+
+  EXPECT_THROW(s21::mapped_vector<int>(path, s21::mapped_mode::read_only),
+               std::system_error);
+}
+
+TEST(MappedVectorConstructors, RejectsForeignFile) {
+  std::string path = MappedPath("foreign");
+  {
+    std::FILE *file = std::fopen(path.c_str(), "w");
+    std::fputs("definitely not a mapped vector, just some text", file);
+    std::fclose(file);
+  }
+
+  EXPECT_THROW(s21::mapped_vector<int>{path}, std::runtime_error);
+
+  std::remove(path.c_str());
+}
+
+TEST(MappedVectorConstructors, RejectsDifferentElementSize) {
+  std::string path = MappedPath("element_size");
+  {
+    s21::mapped_vector<int> s21_v(path);
+    s21_v.push_back(1);
+  }
+
+  EXPECT_THROW(s21::mapped_vector<double>{path}, std::runtime_error);
+
+  std::remove(path.c_str());
+}
+
+TEST(MappedVectorPersistence, SurvivesReopen) {
+  std::string path = MappedPath("reopen");
+  std::vector<Record> std_v;
+  {
+    s21::mapped_vector<Record> s21_v(path);
+    for (int i = 0; i < 10000; ++i) {
+      s21_v.push_back({i, i * 0.5});
+      std_v.push_back({i, i * 0.5});
+    }
+    s21_v.flush();
+  }
+
+  s21::mapped_vector<Record> s21_v(path, s21::mapped_mode::read_only);
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  for (size_t i = 0; i < std_v.size(); ++i) {
+    EXPECT_EQ(s21_v[i].id, std_v[i].id);
+    EXPECT_EQ(s21_v[i].score, std_v[i].score);
+  }
+
+  std::remove(path.c_str());
+}
+
+TEST(MappedVectorPersistence, ReadOnlyRejectsMutation) {
+  std::string path = MappedPath("read_only");
+  {
+    s21::mapped_vector<int> s21_v(path);
+    s21_v.push_back(5);
+  }
+
+  s21::mapped_vector<int> s21_v(path, s21::mapped_mode::read_only);
+  EXPECT_TRUE(s21_v.read_only());
+  EXPECT_EQ(s21_v.at(0), 5);
+  EXPECT_THROW(s21_v.push_back(6), std::logic_error);
+  EXPECT_THROW(s21_v.clear(), std::logic_error);
+  EXPECT_NO_THROW(s21_v.flush());
+
+  std::remove(path.c_str());
+}
+
+TEST(MappedVectorModifiers, InsertEraseMatchStd) {
+  std::string path = MappedPath("modifiers");
+  s21::mapped_vector<int> s21_v(path);
+  std::vector<int> std_v;
+
+  for (int i = 0; i < 5; ++i) {
+    s21_v.push_back(i);
+    std_v.push_back(i);
+  }
+  s21_v.insert(++s21_v.begin(), 9);
+  std_v.insert(++std_v.begin(), 9);
+  s21_v.erase(s21_v.begin());
+  std_v.erase(std_v.begin());
+  s21_v.pop_back();
+  std_v.pop_back();
+
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  auto it = s21_v.begin();
+  for (size_t i = 0; i < std_v.size(); ++i, ++it) {
+    EXPECT_EQ(*it, std_v[i]);
+  }
+  EXPECT_THROW(s21_v.at(10), std::out_of_range);
+  EXPECT_THROW(s21_v.erase(s21_v.end()), std::out_of_range);
+
+  std::remove(path.c_str());
+}
+
+TEST(MappedVectorCapacity, ReserveAndShrink) {
+  std::string path = MappedPath("capacity");
+  s21::mapped_vector<int> s21_v(path);
+
+  s21_v.push_back(1);
+  s21_v.reserve(1000);
+  EXPECT_EQ(s21_v.capacity(), 1000);
+  EXPECT_EQ(s21_v.front(), 1);
+
+  s21_v.shrink_to_fit();
+  EXPECT_EQ(s21_v.capacity(), 1);
+  EXPECT_EQ(s21_v.back(), 1);
+
+  std::remove(path.c_str());
+}
+
+TEST(MappedVectorModifiers, MoveAndSwap) {
+  std::string path_1 = MappedPath("move_1");
+  std::string path_2 = MappedPath("move_2");
+  s21::mapped_vector<int> s21_v_1(path_1);
+  s21::mapped_vector<int> s21_v_2(path_2);
+  s21_v_1.push_back(1);
+  s21_v_2.push_back(2);
+  s21_v_2.push_back(3);
+
+  s21_v_1.swap(s21_v_2);
+  EXPECT_EQ(s21_v_1.size(), 2);
+  EXPECT_EQ(s21_v_2.front(), 1);
+
+  s21::mapped_vector<int> s21_v_3(std::move(s21_v_1));
+  EXPECT_EQ(s21_v_3.back(), 3);
+  EXPECT_EQ(s21_v_1.data(), nullptr);
+
+  s21_v_1.clear();
+  s21_v_1.pop_back();
+  EXPECT_TRUE(s21_v_1.empty());
+  EXPECT_EQ(s21_v_1.capacity(), 0);
+  EXPECT_THROW(s21_v_1.push_back(4), std::system_error);
+  EXPECT_EQ(s21_v_1.data(), nullptr);
+
+  std::remove(path_1.c_str());
+  std::remove(path_2.c_str());
+}
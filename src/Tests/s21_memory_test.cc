@@ -0,0 +1,97 @@
+#include "../Containers/s21_memory.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <memory>
+
+TEST(GrowthPolicy, Doubling) {
+  EXPECT_EQ(s21::doubling_growth::next_capacity(0, 1, sizeof(int)), 1);
+  EXPECT_EQ(s21::doubling_growth::next_capacity(1, 2, sizeof(int)), 2);
+  EXPECT_EQ(s21::doubling_growth::next_capacity(64, 65, sizeof(int)), 128);
+  EXPECT_EQ(s21::doubling_growth::next_capacity(4, 100, sizeof(int)), 100);
+}
+
+TEST(GrowthPolicy, Golden) {
+  EXPECT_EQ(s21::golden_growth::next_capacity(0, 1, sizeof(int)), 1);
+  EXPECT_EQ(s21::golden_growth::next_capacity(1, 2, sizeof(int)), 2);
+  EXPECT_EQ(s21::golden_growth::next_capacity(64, 65, sizeof(int)), 96);
+}
+
+TEST(GrowthPolicy, SizeClass) {
+  EXPECT_EQ(s21::size_class_growth::next_capacity(0, 1, sizeof(int)), 4);
+  EXPECT_EQ(s21::size_class_growth::next_capacity(4, 5, sizeof(int)), 8);
+  EXPECT_EQ(s21::size_class_growth::next_capacity(12, 13, sizeof(int)), 32);
+  EXPECT_EQ(s21::size_class_growth::next_capacity(1024, 1025, sizeof(int)),
+            2048);
+  EXPECT_EQ(s21::size_class_growth::next_capacity(1, 2, 3000), 2);
+}
+
+TEST(MallocAllocator, Traits) {
+  EXPECT_TRUE(s21::has_reallocate<s21::malloc_allocator<int>>::value);
+  EXPECT_FALSE(s21::has_reallocate<std::allocator<int>>::value);
+  EXPECT_TRUE(s21::malloc_allocator<int>() == s21::malloc_allocator<char>());
+}
+
+TEST(MallocAllocator, ReallocateKeepsContents) {
+  s21::malloc_allocator<int> alloc;
+  int *p = alloc.allocate(4);
+  for (int i = 0; i < 4; ++i) {
+    p[i] = i * 10;
+  }
+
+  p = alloc.reallocate(p, 4, 1 << 20);
+  EXPECT_EQ(p[0], 0);
+  EXPECT_EQ(p[3], 30);
+  p[(1 << 20) - 1] = 7;
+
+  alloc.deallocate(p, 1 << 20);
+}
+
+TEST(HugePageAllocator, SmallBlocksUseMalloc) {
+  s21::huge_page_allocator<int> alloc(1 << 20, 8 << 20);
+  int *p = alloc.allocate(16);
+
+  EXPECT_FALSE(s21::huge_page_allocator<int>::is_huge_page_backed(p));
+  p = alloc.reallocate(p, 16, 32);
+  EXPECT_FALSE(s21::huge_page_allocator<int>::is_huge_page_backed(p));
+
+  alloc.deallocate(p, 32);
+}
+
+TEST(HugePageAllocator, GrowthInsideReservationDoesNotMove) {
+  if (!s21::huge_page_allocator<char>::HugePagesAvailable()) {
+    GTEST_SKIP() << "transparent huge pages are not available";
+  }
+
+  s21::huge_page_allocator<char> alloc(1 << 20, 64 << 20);
+  char *p = alloc.allocate(2 << 20);
+  ASSERT_TRUE(s21::huge_page_allocator<char>::is_huge_page_backed(p));
+  p[0] = 'a';
+
+  char *grown = alloc.reallocate(p, 2 << 20, 32 << 20);
+  EXPECT_EQ(grown, p);
+  grown[(32 << 20) - 1] = 'z';
+
+  char *moved = alloc.reallocate(grown, 32 << 20, 128 << 20);
+  EXPECT_EQ(moved[0], 'a');
+  EXPECT_EQ(moved[(32 << 20) - 1], 'z');
+
+  alloc.deallocate(moved, 128 << 20);
+}
+
+TEST(HugePageAllocator, PromotesMallocBlockPastThreshold) {
+  if (!s21::huge_page_allocator<int>::HugePagesAvailable()) {
+    GTEST_SKIP() << "transparent huge pages are not available";
+  }
+
+  s21::huge_page_allocator<int> alloc(1 << 20, 8 << 20);
+  int *p = alloc.allocate(4);
+  p[3] = 42;
+
+  p = alloc.reallocate(p, 4, 1 << 20);
+  EXPECT_TRUE(s21::huge_page_allocator<int>::is_huge_page_backed(p));
+  EXPECT_EQ(p[3], 42);
+
+  alloc.deallocate(p, 1 << 20);
+}
@@ -0,0 +1,136 @@
+#include "../Containers/s21_parallel.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../Containers/s21_vector.h"
+
+static s21::parallel::options SmallGrain(s21::thread_pool *pool) {
+  s21::parallel::options opts;
+  opts.grain = 1000;
+  opts.pool = pool;
+  return opts;
+}
+
+TEST(ThreadPool, RunsEveryTaskOnce) {
+  s21::thread_pool pool(4);
+  std::vector<int> hits(10000, 0);
+
+  pool.run(hits.size(), [&](size_t i) { ++hits[i]; });
+
+  EXPECT_EQ(pool.size(), 4);
+  EXPECT_EQ(std::count(hits.begin(), hits.end(), 1), 10000);
+}
+
+TEST(ThreadPool, NestedRun) {
+  s21::thread_pool pool(3);
+  std::vector<int> hits(64, 0);
+
+  pool.run(8, [&](size_t outer) {
+    pool.run(8, [&](size_t inner) { ++hits[outer * 8 + inner]; });
+  });
+
+  EXPECT_EQ(std::count(hits.begin(), hits.end(), 1), 64);
+}
+
+TEST(ThreadPool, RethrowsTaskException) {
+  s21::thread_pool pool(4);
+
+  EXPECT_THROW(pool.run(100,
+                        [](size_t i) {
+                          if (i == 42) {
+                            throw std::runtime_error("task failed");
+                          }
+                        }),
+               std::runtime_error);
+}
+
+TEST(Parallel, ForEachAndFill) {
+  s21::thread_pool pool(4);
+  s21::vector<int> s21_v(100000);
+
+  s21::parallel::fill(s21_v.begin(), s21_v.end(), 3, SmallGrain(&pool));
+  s21::parallel::for_each(
+      s21_v.begin(), s21_v.end(), [](int &x) { x *= 2; }, SmallGrain(&pool));
+
+  EXPECT_EQ(std::count(s21_v.begin(), s21_v.end(), 6), 100000);
+}
+
+TEST(Parallel, TransformAndCopy) {
+  s21::thread_pool pool(4);
+  s21::vector<int> s21_in(50001);
+  s21::vector<long> s21_out(50001);
+  s21::vector<long> s21_copy(50001);
+  std::iota(s21_in.begin(), s21_in.end(), 0);
+
+  auto end = s21::parallel::transform(
+      s21_in.begin(), s21_in.end(), s21_out.begin(),
+      [](int x) { return static_cast<long>(x) * x; }, SmallGrain(&pool));
+  s21::parallel::copy(s21_out.begin(), s21_out.end(), s21_copy.begin(),
+                      SmallGrain(&pool));
+
+  EXPECT_EQ(end, s21_out.end());
+  for (size_t i = 0; i < s21_in.size(); i += 101) {
+    EXPECT_EQ(s21_copy[i], static_cast<long>(i) * static_cast<long>(i));
+  }
+}
+
+TEST(Parallel, Reduce) {
+  s21::thread_pool pool(4);
+  s21::vector<long> s21_v(123457);
+  std::iota(s21_v.begin(), s21_v.end(), 1);
+
+  long sum = s21::parallel::reduce(s21_v.begin(), s21_v.end(), 10L,
+                                   std::plus<long>(), SmallGrain(&pool));
+  long empty = s21::parallel::reduce(s21_v.begin(), s21_v.begin(), 7L);
+
+  EXPECT_EQ(sum, 10L + 123457L * 123458L / 2);
+  EXPECT_EQ(empty, 7L);
+}
+
+TEST(Parallel, SortMatchesStd) {
+  s21::thread_pool pool(4);
+  std::mt19937 gen(21);
+  s21::vector<int> s21_v;
+  std::vector<int> std_v;
+  for (int i = 0; i < 77777; ++i) {
+    int value = static_cast<int>(gen() % 1000);
+    s21_v.push_back(value);
+    std_v.push_back(value);
+  }
+
+  s21::parallel::sort(s21_v.begin(), s21_v.end(), std::less<int>(),
+                      SmallGrain(&pool));
+  std::sort(std_v.begin(), std_v.end());
+
+  EXPECT_TRUE(std::equal(std_v.begin(), std_v.end(), s21_v.begin()));
+}
+
+TEST(Parallel, SortIsStable) {
+  s21::thread_pool pool(4);
+  std::mt19937 gen(42);
+  s21::vector<std::pair<int, int>> s21_v;
+  for (int i = 0; i < 20000; ++i) {
+    s21_v.push_back({static_cast<int>(gen() % 16), i});
+  }
+
+  s21::parallel::sort(
+      s21_v.begin(), s21_v.end(),
+      [](const std::pair<int, int> &lhs, const std::pair<int, int> &rhs) {
+        return lhs.first < rhs.first;
+      },
+      SmallGrain(&pool));
+
+  for (size_t i = 1; i < s21_v.size(); ++i) {
+    ASSERT_LE(s21_v[i - 1].first, s21_v[i].first);
+    if (s21_v[i - 1].first == s21_v[i].first) {
+      ASSERT_LT(s21_v[i - 1].second, s21_v[i].second);
+    }
+  }
+}
@@ -0,0 +1,149 @@
+#include "../Containers/s21_radix_sort.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+template <typename T>
+static s21::vector<T> RandomKeys(size_t n, unsigned seed) {
+  std::mt19937_64 gen(seed);
+  s21::vector<T> keys;
+  keys.reserve(n);
+
+  for (size_t i = 0; i < n; ++i) {
+    if constexpr (std::is_floating_point<T>::value) {
+      std::uniform_real_distribution<T> dist(-1e6, 1e6);
+      keys.push_back(dist(gen));
+    } else {
+      keys.push_back(static_cast<T>(gen()));
+    }
+  }
+
+  return keys;
+}
+
+template <typename T>
+class RadixSortTest : public testing::Test {};
+
+using RadixKeyTypes =
+    testing::Types<uint8_t, int16_t, uint32_t, int32_t, uint64_t, int64_t,
+                   float, double>;
+TYPED_TEST_SUITE(RadixSortTest, RadixKeyTypes);
+
+TYPED_TEST(RadixSortTest, MatchesStdSort) {
+  for (size_t n : {0, 1, 2, 63, 64, 1000, 100000}) {
+    s21::vector<TypeParam> s21_keys = RandomKeys<TypeParam>(n, 1);
+    std::vector<TypeParam> std_keys(s21_keys.begin(), s21_keys.end());
+
+    s21::radix_sort(s21_keys);
+    std::sort(std_keys.begin(), std_keys.end());
+
+    EXPECT_TRUE(std::equal(std_keys.begin(), std_keys.end(), s21_keys.begin()))
+        << n;
+  }
+}
+
+TYPED_TEST(RadixSortTest, ParallelMatchesStdSort) {
+  s21::thread_pool pool(4);
+  s21::parallel::options opts;
+  opts.grain = 1000;
+  opts.pool = &pool;
+
+  s21::vector<TypeParam> s21_keys = RandomKeys<TypeParam>(50000, 2);
+  std::vector<TypeParam> std_keys(s21_keys.begin(), s21_keys.end());
+
+  s21::parallel::radix_sort(s21_keys.data(), s21_keys.data() + 50000, opts);
+  std::sort(std_keys.begin(), std_keys.end());
+
+  EXPECT_TRUE(std::equal(std_keys.begin(), std_keys.end(), s21_keys.begin()));
+}
+
+TEST(RadixSort, SpecialFloats) {
+  const float inf = std::numeric_limits<float>::infinity();
+  s21::vector<float> keys = {3.5f, -0.0f, inf, -inf, 0.0f, -2.25f, 1e-30f};
+  for (int i = 0; i < 100; ++i) {
+    keys.push_back(static_cast<float>(i % 7) - 3);
+  }
+  std::vector<float> expected(keys.begin(), keys.end());
+
+  s21::radix_sort(keys);
+  std::stable_sort(expected.begin(), expected.end());
+
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), keys.begin()));
+  EXPECT_EQ(keys.front(), -inf);
+  EXPECT_EQ(keys.back(), inf);
+}
+
+TEST(RadixSort, SmallKeysInWideType) {
+  s21::thread_pool pool(4);
+  s21::parallel::options opts;
+  opts.grain = 4096;
+  opts.pool = &pool;
+
+  std::mt19937 gen(5);
+  s21::vector<uint64_t> keys;
+  for (int i = 0; i < 100000; ++i) {
+    keys.push_back(gen() % 5000);
+  }
+  std::vector<uint64_t> expected(keys.begin(), keys.end());
+
+  s21::parallel::radix_sort(keys.data(), keys.data() + keys.size(), opts);
+  std::sort(expected.begin(), expected.end());
+
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), keys.begin()));
+}
+
+TEST(RadixSortByKey, StablePayload) {
+  std::mt19937 gen(3);
+  s21::vector<int32_t> keys;
+  s21::vector<uint32_t> rows;
+  std::vector<std::pair<int32_t, uint32_t>> expected;
+  for (uint32_t i = 0; i < 20000; ++i) {
+    int32_t key = static_cast<int32_t>(gen() % 1000) - 500;
+    keys.push_back(key);
+    rows.push_back(i);
+    expected.emplace_back(key, i);
+  }
+
+  s21::vector<int32_t> parallel_keys = keys;
+  s21::vector<uint32_t> parallel_rows = rows;
+  s21::parallel::options opts;
+  opts.grain = 1024;
+
+  s21::radix_sort_by_key(keys, rows);
+  s21::parallel::radix_sort_by_key(parallel_keys.data(),
+                                   parallel_keys.data() + parallel_keys.size(),
+                                   parallel_rows.data(), opts);
+  std::stable_sort(expected.begin(), expected.end(),
+                   [](const auto &a, const auto &b) { return a.first < b.first; });
+
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(keys[i], expected[i].first);
+    EXPECT_EQ(rows[i], expected[i].second);
+    EXPECT_EQ(parallel_keys[i], expected[i].first);
+    EXPECT_EQ(parallel_rows[i], expected[i].second);
+  }
+}
+
+TEST(RadixSortByKey, SizeMismatch) {
+  s21::vector<uint32_t> keys = {3, 1, 2};
+  s21::vector<double> values = {1.0};
+
+  EXPECT_THROW(s21::radix_sort_by_key(keys, values), std::invalid_argument);
+}
+
+TEST(RadixSort, AllEqual) {
+  s21::vector<uint32_t> keys(10000);
+  s21::parallel::options opts;
+  opts.grain = 100;
+
+  s21::parallel::radix_sort(keys.data(), keys.data() + keys.size(), opts);
+  s21::radix_sort(keys);
+
+  EXPECT_EQ(std::count(keys.begin(), keys.end(), 0u), 10000);
+}
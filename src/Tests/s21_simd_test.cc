@@ -0,0 +1,149 @@
+#include "../Containers/s21_simd.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+template <typename T>
+class SimdKernels : public testing::Test {
+ protected:
+  void TearDown() override { s21::simd::use_isa(s21::simd::detected_isa()); }
+
+  static std::vector<s21::simd::isa> Levels() {
+    std::vector<s21::simd::isa> levels;
+    for (auto level : {s21::simd::isa::scalar, s21::simd::isa::sse2,
+                       s21::simd::isa::avx2, s21::simd::isa::avx512}) {
+      if (level <= s21::simd::detected_isa()) {
+        levels.push_back(level);
+      }
+    }
+    return levels;
+  }
+
+  static s21::vector<T> Random(size_t n, unsigned seed) {
+    std::mt19937 gen(seed);
+    s21::vector<T> v;
+    for (size_t i = 0; i < n; ++i) {
+      v.push_back(static_cast<T>(gen() % 100));
+    }
+    return v;
+  }
+};
+
+using SimdTypes = testing::Types<int, float, double, uint8_t>;
+TYPED_TEST_SUITE(SimdKernels, SimdTypes);
+
+TYPED_TEST(SimdKernels, FindAndCount) {
+  for (auto level : this->Levels()) {
+    s21::simd::use_isa(level);
+    for (size_t n : {0, 1, 7, 64, 1000, 4099}) {
+      auto v = this->Random(n, 7);
+      std::vector<TypeParam> expected(v.begin(), v.end());
+      TypeParam needle = static_cast<TypeParam>(42);
+
+      size_t index =
+          std::find(expected.begin(), expected.end(), needle) - expected.begin();
+      EXPECT_EQ(s21::simd::find(v, needle), index);
+      EXPECT_EQ(s21::simd::count(v, needle),
+                static_cast<size_t>(
+                    std::count(expected.begin(), expected.end(), needle)));
+    }
+  }
+}
+
+TYPED_TEST(SimdKernels, CountManyMatches) {
+  for (auto level : this->Levels()) {
+    s21::simd::use_isa(level);
+    s21::vector<TypeParam> v(100003);
+    std::fill(v.begin(), v.end(), static_cast<TypeParam>(3));
+
+    EXPECT_EQ(s21::simd::count(v, static_cast<TypeParam>(3)), 100003);
+    EXPECT_EQ(s21::simd::find(v, static_cast<TypeParam>(4)), 100003);
+  }
+}
+
+TYPED_TEST(SimdKernels, MinMax) {
+  for (auto level : this->Levels()) {
+    s21::simd::use_isa(level);
+    for (size_t n : {1, 3, 65, 1000}) {
+      auto v = this->Random(n, 11);
+      v[n / 2] = static_cast<TypeParam>(120);
+      v[n - 1] = static_cast<TypeParam>(0);
+
+      EXPECT_EQ(s21::simd::max(v), static_cast<TypeParam>(n == 1 ? 0 : 120));
+      EXPECT_EQ(s21::simd::min(v), static_cast<TypeParam>(0));
+    }
+  }
+
+  s21::vector<TypeParam> empty;
+  EXPECT_THROW(s21::simd::min(empty), std::invalid_argument);
+  EXPECT_THROW(s21::simd::max(empty), std::invalid_argument);
+}
+
+TYPED_TEST(SimdKernels, SumAndDot) {
+  using Acc = s21::simd::accumulator_t<TypeParam>;
+
+  for (auto level : this->Levels()) {
+    s21::simd::use_isa(level);
+    for (size_t n : {0, 5, 129, 3001}) {
+      auto a = this->Random(n, 3);
+      auto b = this->Random(n, 5);
+
+      Acc sum = 0;
+      Acc dot = 0;
+      for (size_t i = 0; i < n; ++i) {
+        sum += a[i];
+        dot += static_cast<Acc>(a[i]) * static_cast<Acc>(b[i]);
+      }
+
+      EXPECT_EQ(s21::simd::sum(a), sum);
+      EXPECT_EQ(s21::simd::dot(a, b), dot);
+    }
+  }
+}
+
+TYPED_TEST(SimdKernels, Equal) {
+  for (auto level : this->Levels()) {
+    s21::simd::use_isa(level);
+    auto a = this->Random(1001, 9);
+    auto b = a;
+
+    EXPECT_TRUE(s21::simd::equal(a, b));
+    b[1000] = static_cast<TypeParam>(b[1000] + 1);
+    EXPECT_FALSE(s21::simd::equal(a, b));
+    b[1000] = a[1000];
+    b[3] = static_cast<TypeParam>(b[3] + 1);
+    EXPECT_FALSE(s21::simd::equal(a, b));
+    b.pop_back();
+    EXPECT_FALSE(s21::simd::equal(a, b));
+  }
+}
+
+TEST(SimdDispatch, UseIsaClampsToDetected) {
+  s21::simd::use_isa(s21::simd::isa::avx512);
+  EXPECT_EQ(s21::simd::active_isa(), s21::simd::detected_isa());
+
+  s21::simd::use_isa(s21::simd::isa::scalar);
+  EXPECT_EQ(s21::simd::active_isa(), s21::simd::isa::scalar);
+
+  s21::simd::use_isa(s21::simd::detected_isa());
+}
+
+TEST(SimdDispatch, DotRejectsMismatchedSizes) {
+  s21::vector<int> a = {1, 2, 3};
+  s21::vector<int> b = {1, 2};
+
+  EXPECT_THROW(s21::simd::dot(a, b), std::invalid_argument);
+}
+
+TEST(SimdDispatch, ByteSumDoesNotOverflow) {
+  s21::vector<uint8_t> v(1 << 20);
+  std::fill(v.begin(), v.end(), static_cast<uint8_t>(255));
+
+  EXPECT_EQ(s21::simd::sum(v), uint64_t(255) << 20);
+  EXPECT_EQ(s21::simd::dot(v, v), uint64_t(255 * 255) << 20);
+}
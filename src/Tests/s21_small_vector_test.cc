@@ -0,0 +1,229 @@
+#include "../Containers/s21_small_vector.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Counts live objects and throws once copies_left copies have been made.
+struct SmallThrowingCopy {
+  SmallThrowingCopy(int value, int *live, int *copies_left)
+      : value(value), live(live), copies_left(copies_left) {
+    ++*live;
+  }
+  SmallThrowingCopy(const SmallThrowingCopy &other)
+      : value(other.value), live(other.live), copies_left(other.copies_left) {
+    if ((*copies_left)-- == 0) {
+      throw std::runtime_error("copy");
+    }
+    ++*live;
+  }
+  ~SmallThrowingCopy() { --*live; }
+
+  int value;
+  int *live;
+  int *copies_left;
+};
+
+TEST(SmallVectorConstructors, DefaultConstructor) {
+  s21::small_vector<int, 4> s21_v;
+  std::vector<int> std_v;
+
+  EXPECT_EQ(s21_v.size(), std_v.size());
+  EXPECT_EQ(s21_v.empty(), std_v.empty());
+  EXPECT_EQ(s21_v.capacity(), 4);
+  EXPECT_TRUE(s21_v.is_inline());
+}
+
+TEST(SmallVectorConstructors, SizeConstructor) {
+  s21::small_vector<double, 4> s21_small(3);
+  s21::small_vector<double, 4> s21_big(10);
+
+  EXPECT_EQ(s21_small.size(), 3);
+  EXPECT_TRUE(s21_small.is_inline());
+  EXPECT_EQ(s21_big.size(), 10);
+  EXPECT_FALSE(s21_big.is_inline());
+  EXPECT_EQ(s21_big[9], 0.0);
+}
+
+TEST(SmallVectorConstructors, InitializerListConstructor) {
+  s21::small_vector<int, 2> s21_v = {3, 3, 1, 2};
+  std::vector<int> std_v = {3, 3, 1, 2};
+
+  EXPECT_EQ(s21_v.size(), std_v.size());
+  EXPECT_EQ(s21_v.front(), std_v.front());
+  EXPECT_EQ(s21_v.back(), std_v.back());
+}
+
+TEST(SmallVectorConstructors, CopyConstructor) {
+  s21::small_vector<std::string, 2> s21_inline = {"a", "b"};
+  s21::small_vector<std::string, 2> s21_heap = {"a", "b", "c"};
+
+  s21::small_vector<std::string, 2> s21_inline_copy(s21_inline);
+  s21::small_vector<std::string, 2> s21_heap_copy(s21_heap);
+
+  EXPECT_TRUE(s21_inline_copy.is_inline());
+  EXPECT_FALSE(s21_heap_copy.is_inline());
+  EXPECT_NE(s21_heap_copy.data(), s21_heap.data());
+  for (size_t i = 0; i < s21_heap.size(); ++i) {
+    EXPECT_EQ(s21_heap_copy[i], s21_heap[i]);
+  }
+  EXPECT_EQ(s21_inline_copy[1], "b");
+}
+
+TEST(SmallVectorConstructors, MoveConstructorInline) {
+  s21::small_vector<std::string, 4> s21_v_1 = {"q", "w", "e"};
+  s21::small_vector<std::string, 4> s21_v_2(std::move(s21_v_1));
+
+  EXPECT_TRUE(s21_v_1.empty());
+  EXPECT_TRUE(s21_v_2.is_inline());
+  EXPECT_EQ(s21_v_2.size(), 3);
+  EXPECT_EQ(s21_v_2[2], "e");
+}
+
+TEST(SmallVectorConstructors, MoveConstructorHeap) {
+  s21::small_vector<int, 2> s21_v_1 = {1, 2, 3, 4};
+  int *buffer = s21_v_1.data();
+  s21::small_vector<int, 2> s21_v_2(std::move(s21_v_1));
+
+  EXPECT_TRUE(s21_v_1.empty());
+  EXPECT_TRUE(s21_v_1.is_inline());
+  EXPECT_EQ(s21_v_2.data(), buffer);
+  EXPECT_EQ(s21_v_2.size(), 4);
+}
+
+TEST(SmallVectorConstructors, AssignmentOperators) {
+  s21::small_vector<int, 2> s21_v_1 = {1, 2, 3};
+  s21::small_vector<int, 2> s21_v_2 = {9};
+  s21::small_vector<int, 2> s21_v_3;
+
+  s21_v_2 = s21_v_1;
+  s21_v_3 = std::move(s21_v_1);
+
+  EXPECT_EQ(s21_v_2.size(), 3);
+  EXPECT_EQ(s21_v_3.size(), 3);
+  EXPECT_EQ(s21_v_2[2], 3);
+  EXPECT_EQ(s21_v_3[2], 3);
+  EXPECT_TRUE(s21_v_1.empty());
+}
+
+TEST(SmallVectorElementAccess, AtThrow) {
+  s21::small_vector<int> s21_v = {1, 2};
+
+  EXPECT_EQ(s21_v.at(1), 2);
+  EXPECT_THROW(s21_v.at(2), std::out_of_range);
+}
+
+TEST(SmallVectorCapacity, ReserveAndShrinkToFit) {
+  s21::small_vector<int, 4> s21_v = {1, 2, 3};
+
+  s21_v.reserve(16);
+  EXPECT_FALSE(s21_v.is_inline());
+  EXPECT_EQ(s21_v.capacity(), 16);
+
+  s21_v.shrink_to_fit();
+  EXPECT_TRUE(s21_v.is_inline());
+  EXPECT_EQ(s21_v.capacity(), 4);
+  EXPECT_EQ(s21_v[2], 3);
+}
+
+TEST(SmallVectorCapacity, ThrowingCopyKeepsElements) {
+  int live = 0;
+  int copies_left = 100;
+  {
+    s21::small_vector<SmallThrowingCopy, 4> s21_v;
+    for (int i = 0; i < 4; ++i) {
+      s21_v.push_back(SmallThrowingCopy(i, &live, &copies_left));
+    }
+
+    copies_left = 2;
+    EXPECT_THROW(s21_v.reserve(16), std::runtime_error);
+    EXPECT_TRUE(s21_v.is_inline());
+    EXPECT_EQ(live, 4);
+
+    copies_left = 100;
+    s21_v.reserve(16);
+    s21_v.pop_back();
+    copies_left = 1;
+    EXPECT_THROW(s21_v.shrink_to_fit(), std::runtime_error);
+    EXPECT_FALSE(s21_v.is_inline());
+    EXPECT_EQ(live, 3);
+    EXPECT_EQ(s21_v[2].value, 2);
+  }
+  EXPECT_EQ(live, 0);
+}
+
+TEST(SmallVectorModifiers, PushBackSpillsToHeap) {
+  s21::small_vector<int, 4> s21_v;
+  std::vector<int> std_v;
+
+  for (int i = 0; i < 4; ++i) {
+    s21_v.push_back(i);
+    std_v.push_back(i);
+  }
+  EXPECT_TRUE(s21_v.is_inline());
+
+  for (int i = 4; i < 100; ++i) {
+    s21_v.push_back(i);
+    std_v.push_back(i);
+  }
+  EXPECT_FALSE(s21_v.is_inline());
+
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  for (size_t i = 0; i < std_v.size(); ++i) {
+    EXPECT_EQ(s21_v[i], std_v[i]);
+  }
+}
+
+TEST(SmallVectorModifiers, PushBackSelfReference) {
+  s21::small_vector<std::string, 1> s21_v = {"x"};
+
+  s21_v.push_back(s21_v[0]);
+
+  EXPECT_EQ(s21_v.size(), 2);
+  EXPECT_EQ(s21_v[1], "x");
+}
+
+TEST(SmallVectorModifiers, InsertErase) {
+  s21::small_vector<int, 3> s21_v = {1, 2, 3};
+  std::vector<int> std_v = {1, 2, 3};
+
+  s21_v.insert(++s21_v.begin(), 5);
+  std_v.insert(++std_v.begin(), 5);
+  s21_v.insert(s21_v.end(), 7);
+  std_v.insert(std_v.end(), 7);
+  s21_v.erase(s21_v.begin());
+  std_v.erase(std_v.begin());
+
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  for (size_t i = 0; i < std_v.size(); ++i) {
+    EXPECT_EQ(s21_v[i], std_v[i]);
+  }
+  EXPECT_THROW(s21_v.erase(s21_v.end()), std::out_of_range);
+}
+
+TEST(SmallVectorModifiers, PopBackClear) {
+  s21::small_vector<std::string, 2> s21_v = {"a", "b", "c"};
+
+  s21_v.pop_back();
+  EXPECT_EQ(s21_v.back(), "b");
+
+  s21_v.clear();
+  s21_v.pop_back();
+  EXPECT_TRUE(s21_v.empty());
+}
+
+TEST(SmallVectorModifiers, SwapMixed) {
+  s21::small_vector<std::string, 2> s21_inline = {"a"};
+  s21::small_vector<std::string, 2> s21_heap = {"b", "c", "d"};
+
+  s21_inline.swap(s21_heap);
+
+  EXPECT_EQ(s21_inline.size(), 3);
+  EXPECT_FALSE(s21_inline.is_inline());
+  EXPECT_EQ(s21_inline[2], "d");
+  EXPECT_EQ(s21_heap.size(), 1);
+  EXPECT_TRUE(s21_heap.is_inline());
+  EXPECT_EQ(s21_heap[0], "a");
+}
@@ -0,0 +1,178 @@
+#include "../Containers/s21_soa_vector.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <tuple>
+
+TEST(SoaVectorConstructors, Default) {
+  s21::soa_vector<int, double> s21_v;
+
+  EXPECT_TRUE(s21_v.empty());
+  EXPECT_EQ(s21_v.capacity(), 0);
+  EXPECT_EQ(s21_v.data<0>(), nullptr);
+}
+
+TEST(SoaVectorConstructors, SizeAndInitializerList) {
+  s21::soa_vector<int, std::string> s21_v_1(3);
+  s21::soa_vector<int, std::string> s21_v_2 = {{1, "one"}, {2, "two"}};
+
+  EXPECT_EQ(s21_v_1.size(), 3);
+  EXPECT_EQ(std::get<0>(s21_v_1[2]), 0);
+  EXPECT_EQ(std::get<1>(s21_v_1[2]), "");
+  EXPECT_EQ(std::get<1>(s21_v_2.back()), "two");
+}
+
+TEST(SoaVectorConstructors, CopyAndMove) {
+  s21::soa_vector<int, std::string> s21_v_1;
+  for (int i = 0; i < 100; ++i) {
+    s21_v_1.push_back(i, std::to_string(i));
+  }
+
+  s21::soa_vector<int, std::string> s21_v_2(s21_v_1);
+  s21::soa_vector<int, std::string> s21_v_3(std::move(s21_v_1));
+  s21::soa_vector<int, std::string> s21_v_4 = {{7, "seven"}};
+  s21_v_4 = s21_v_2;
+  s21_v_2 = std::move(s21_v_3);
+
+  EXPECT_TRUE(s21_v_1.empty());
+  EXPECT_TRUE(s21_v_3.empty());
+  EXPECT_EQ(s21_v_2.size(), 100);
+  EXPECT_EQ(s21_v_4.size(), 100);
+  EXPECT_EQ(std::get<1>(s21_v_4[42]), "42");
+  EXPECT_EQ(std::get<0>(s21_v_2[99]), 99);
+}
+
+TEST(SoaVectorElementAccess, RowProxy) {
+  s21::soa_vector<int, double, char> s21_v = {{1, 1.5, 'a'}, {2, 2.5, 'b'}};
+
+  auto [id, score, tag] = s21_v[1];
+  score *= 2;
+  tag = 'z';
+  std::get<0>(s21_v.front()) = 10;
+
+  EXPECT_EQ(id, 2);
+  EXPECT_EQ(s21_v.data<1>()[1], 5.0);
+  EXPECT_EQ(s21_v.data<2>()[1], 'z');
+  EXPECT_EQ(std::get<0>(s21_v.at(0)), 10);
+  EXPECT_THROW(s21_v.at(2), std::out_of_range);
+}
+
+TEST(SoaVectorElementAccess, ColumnsAreAlignedAndContiguous) {
+  s21::soa_vector<uint8_t, float, double> s21_v;
+  for (int i = 0; i < 1000; ++i) {
+    s21_v.push_back(static_cast<uint8_t>(i), i * 0.5f, i * 2.0);
+  }
+
+  auto scores = s21_v.column<1>();
+  auto weights = s21_v.column<2>();
+
+  EXPECT_EQ(scores.size(), 1000);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(s21_v.data<0>()) % 64, 0);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(scores.data()) % 64, 0);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(weights.data()) % 64, 0);
+  EXPECT_EQ(std::accumulate(scores.begin(), scores.end(), 0.0f), 249750.0f);
+  for (double &weight : weights) {
+    weight += 1;
+  }
+  EXPECT_EQ(std::get<2>(s21_v[10]), 21.0);
+}
+
+TEST(SoaVectorIterators, RangeFor) {
+  s21::soa_vector<int, int> s21_v;
+  for (int i = 0; i < 50; ++i) {
+    s21_v.push_back(i, 0);
+  }
+
+  for (auto [in, out] : s21_v) {
+    out = in * in;
+  }
+
+  EXPECT_EQ(s21_v.end() - s21_v.begin(), 50);
+  EXPECT_EQ(s21_v.data<1>()[7], 49);
+  EXPECT_EQ(std::get<1>(s21_v.begin()[9]), 81);
+}
+
+TEST(SoaVectorCapacity, SingleGrowthDecision) {
+  s21::soa_vector<char, int64_t> s21_v;
+
+  s21_v.reserve(10);
+  EXPECT_EQ(s21_v.capacity(), 10);
+  for (int i = 0; i < 11; ++i) {
+    s21_v.push_back('x', i);
+  }
+  EXPECT_EQ(s21_v.capacity(), 20);
+
+  s21_v.shrink_to_fit();
+  EXPECT_EQ(s21_v.capacity(), 11);
+  EXPECT_EQ(s21_v.data<1>()[10], 10);
+  EXPECT_THROW(s21_v.reserve(s21_v.max_size() + 1), std::length_error);
+}
+
+TEST(SoaVectorModifiers, PopResizeClearSwap) {
+  s21::soa_vector<std::string, int> s21_v_1 = {{"a", 1}, {"b", 2}, {"c", 3}};
+  s21::soa_vector<std::string, int> s21_v_2;
+
+  s21_v_1.pop_back();
+  EXPECT_EQ(std::get<0>(s21_v_1.back()), "b");
+  s21_v_1.resize(5);
+  EXPECT_EQ(std::get<1>(s21_v_1[4]), 0);
+  s21_v_1.resize(1);
+  EXPECT_EQ(s21_v_1.size(), 1);
+
+  s21_v_1.swap(s21_v_2);
+  EXPECT_TRUE(s21_v_1.empty());
+  EXPECT_EQ(std::get<0>(s21_v_2.front()), "a");
+
+  s21_v_2.clear();
+  EXPECT_TRUE(s21_v_2.empty());
+}
+
+struct ThrowOnCopy {
+  ThrowOnCopy() = default;
+  ThrowOnCopy(const ThrowOnCopy &) { throw std::runtime_error("copy"); }
+};
+
+TEST(SoaVectorModifiers, PushBackThrowKeepsSize) {
+  s21::soa_vector<std::string, ThrowOnCopy> s21_v;
+  ThrowOnCopy value;
+
+  s21_v.reserve(4);
+  EXPECT_THROW(s21_v.push_back(std::string(100, 'x'), value),
+               std::runtime_error);
+  EXPECT_TRUE(s21_v.empty());
+}
+
+struct SoaThrowingCopy {
+  explicit SoaThrowingCopy(int *copies_left) : copies_left(copies_left) {}
+  SoaThrowingCopy(const SoaThrowingCopy &other)
+      : copies_left(other.copies_left) {
+    if ((*copies_left)-- == 0) {
+      throw std::runtime_error("copy");
+    }
+  }
+
+  int *copies_left;
+};
+
+TEST(SoaVectorCapacity, ThrowingReallocationKeepsRows) {
+  int copies_left = 100;
+  s21::soa_vector<std::string, SoaThrowingCopy> s21_v;
+
+  s21_v.reserve(4);
+  for (int i = 0; i < 4; ++i) {
+    s21_v.push_back(std::string(100, 'a' + i), SoaThrowingCopy(&copies_left));
+  }
+
+  copies_left = 2;
+  EXPECT_THROW(s21_v.reserve(100), std::runtime_error);
+  EXPECT_EQ(s21_v.size(), 4);
+  EXPECT_EQ(s21_v.capacity(), 4);
+  EXPECT_EQ(std::get<0>(s21_v[3]), std::string(100, 'd'));
+
+  copies_left = 100;
+  s21_v.reserve(100);
+  EXPECT_EQ(std::get<0>(s21_v[0]), std::string(100, 'a'));
+}
@@ -0,0 +1,356 @@
+#include "../Containers/s21_unrolled_list.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <random>
+#include <string>
+
+template <typename value_type>
+bool CompareUnrolledLists(const s21::unrolled_list<value_type>& my_list,
+                          const std::list<value_type>& std_list) {
+  return my_list.size() == std_list.size() &&
+         std::distance(my_list.begin(), my_list.end()) ==
+             static_cast<std::ptrdiff_t>(std_list.size()) &&
+         std::equal(my_list.begin(), my_list.end(), std_list.begin());
+}
+
+TEST(UnrolledListConstructors, Default) {
+  s21::unrolled_list<int> my_list;
+
+  EXPECT_TRUE(my_list.empty());
+  EXPECT_EQ(my_list.size(), 0);
+  EXPECT_EQ(my_list.begin(), my_list.end());
+}
+
+TEST(UnrolledListConstructors, SizeAndInitializerList) {
+  s21::unrolled_list<int> my_list_1(1000);
+  s21::unrolled_list<std::string> my_list_2 = {"a", "b", "c"};
+
+  EXPECT_EQ(my_list_1.size(), 1000);
+  EXPECT_EQ(std::count(my_list_1.begin(), my_list_1.end(), 0), 1000);
+  EXPECT_EQ(my_list_2.front(), "a");
+  EXPECT_EQ(my_list_2.back(), "c");
+}
+
+TEST(UnrolledListConstructors, CopyAndMove) {
+  s21::unrolled_list<std::string> my_list_1;
+  std::list<std::string> std_list;
+  for (int i = 0; i < 300; ++i) {
+    my_list_1.push_front(std::to_string(i));
+    std_list.push_front(std::to_string(i));
+  }
+
+  s21::unrolled_list<std::string> my_list_2(my_list_1);
+  s21::unrolled_list<std::string> my_list_3(std::move(my_list_1));
+  s21::unrolled_list<std::string> my_list_4 = {"x"};
+  my_list_4 = my_list_2;
+  s21::unrolled_list<std::string> my_list_5 = {"y"};
+  my_list_5 = std::move(my_list_3);
+
+  EXPECT_TRUE(my_list_1.empty());
+  EXPECT_EQ(my_list_1.begin(), my_list_1.end());
+  EXPECT_TRUE(my_list_3.empty());
+  EXPECT_TRUE(CompareUnrolledLists(my_list_2, std_list));
+  EXPECT_TRUE(CompareUnrolledLists(my_list_4, std_list));
+  EXPECT_TRUE(CompareUnrolledLists(my_list_5, std_list));
+}
+
+TEST(UnrolledListLayout, ChunksSpanCacheLines) {
+  using list_type = s21::unrolled_list<int32_t>;
+
+  EXPECT_GE(list_type::chunk_capacity(), 32);
+
+  list_type my_list;
+  for (int i = 0; i < 1000; ++i) {
+    my_list.push_back(i);
+  }
+
+  // Appending fills chunks completely, so elements are contiguous inside
+  // a chunk.
+  auto it = my_list.begin();
+  const int32_t* first = &*it;
+  std::advance(it, list_type::chunk_capacity() - 1);
+  EXPECT_EQ(&*it, first + list_type::chunk_capacity() - 1);
+}
+
+TEST(UnrolledListIterators, BidirectionalTraversal) {
+  s21::unrolled_list<int> my_list;
+  for (int i = 0; i < 500; ++i) {
+    my_list.push_back(i);
+  }
+
+  EXPECT_EQ(std::accumulate(my_list.begin(), my_list.end(), 0), 124750);
+  EXPECT_EQ(*--my_list.end(), 499);
+
+  int expected = 499;
+  bool ordered = true;
+  for (auto it = my_list.end(); it != my_list.begin();) {
+    ordered = ordered && *--it == expected--;
+  }
+  EXPECT_TRUE(ordered);
+}
+
+TEST(UnrolledListModifiers, RandomInsertEraseMatchesStdList) {
+  s21::unrolled_list<int> my_list;
+  std::list<int> std_list;
+  std::mt19937 gen(11);
+
+  for (int i = 0; i < 5000; ++i) {
+    size_t pos = std_list.empty() ? 0 : gen() % (std_list.size() + 1);
+    auto my_it = std::next(my_list.begin(), pos);
+    auto std_it = std::next(std_list.begin(), pos);
+
+    if (gen() % 3 == 0 && std_it != std_list.end()) {
+      my_list.erase(my_it);
+      std_list.erase(std_it);
+    } else {
+      auto inserted = my_list.insert(my_it, i);
+      std_list.insert(std_it, i);
+      ASSERT_EQ(*inserted, i);
+    }
+  }
+
+  EXPECT_TRUE(CompareUnrolledLists(my_list, std_list));
+
+  while (!std_list.empty()) {
+    my_list.erase(std::next(my_list.begin(), std_list.size() / 2));
+    std_list.erase(std::next(std_list.begin(), std_list.size() / 2));
+  }
+  EXPECT_TRUE(my_list.empty());
+  EXPECT_EQ(my_list.begin(), my_list.end());
+}
+
+TEST(UnrolledListModifiers, InsertSplitsFullChunk) {
+  using list_type = s21::unrolled_list<std::string>;
+  list_type my_list;
+  std::list<std::string> std_list;
+  for (size_t i = 0; i < list_type::chunk_capacity(); ++i) {
+    my_list.push_back(std::to_string(i));
+    std_list.push_back(std::to_string(i));
+  }
+
+  my_list.insert(std::next(my_list.begin(), 3), my_list.front());
+  std_list.insert(std::next(std_list.begin(), 3), std_list.front());
+  my_list.insert(--my_list.end(), "tail");
+  std_list.insert(--std_list.end(), "tail");
+
+  EXPECT_TRUE(CompareUnrolledLists(my_list, std_list));
+}
+
+TEST(UnrolledListModifiers, PushPopBothEnds) {
+  s21::unrolled_list<int> my_list;
+  std::list<int> std_list;
+  std::mt19937 gen(3);
+
+  for (int i = 0; i < 3000; ++i) {
+    switch (gen() % 4) {
+      case 0:
+        my_list.push_back(i);
+        std_list.push_back(i);
+        break;
+      case 1:
+        my_list.push_front(i);
+        std_list.push_front(i);
+        break;
+      case 2:
+        my_list.pop_back();
+        if (!std_list.empty()) std_list.pop_back();
+        break;
+      default:
+        my_list.pop_front();
+        if (!std_list.empty()) std_list.pop_front();
+    }
+  }
+
+  EXPECT_TRUE(CompareUnrolledLists(my_list, std_list));
+}
+
+TEST(UnrolledListModifiers, EraseThrow) {
+  s21::unrolled_list<int> my_list = {1, 2, 3};
+
+  EXPECT_THROW(my_list.erase(my_list.end()), std::invalid_argument);
+}
+
+TEST(UnrolledListModifiers, Swap) {
+  s21::unrolled_list<int> my_list_1 = {1, 2, 3};
+  s21::unrolled_list<int> my_list_2;
+
+  my_list_1.swap(my_list_2);
+  my_list_1.push_back(7);
+
+  EXPECT_EQ(my_list_1.size(), 1);
+  EXPECT_EQ(my_list_1.front(), 7);
+  EXPECT_TRUE(CompareUnrolledLists(my_list_2, std::list<int>({1, 2, 3})));
+}
+
+TEST(UnrolledListOperations, Merge) {
+  s21::unrolled_list<int> my_list_1;
+  s21::unrolled_list<int> my_list_2;
+  std::list<int> std_list_1;
+  std::list<int> std_list_2;
+  for (int i = 0; i < 200; ++i) {
+    my_list_1.push_back(i * 3);
+    std_list_1.push_back(i * 3);
+    my_list_2.push_back(i * 2);
+    std_list_2.push_back(i * 2);
+  }
+
+  my_list_1.merge(my_list_2);
+  std_list_1.merge(std_list_2);
+
+  EXPECT_TRUE(CompareUnrolledLists(my_list_1, std_list_1));
+  EXPECT_TRUE(my_list_2.empty());
+}
+
+TEST(UnrolledListOperations, SpliceIntoMiddle) {
+  s21::unrolled_list<int> my_list_1;
+  s21::unrolled_list<int> my_list_2;
+  std::list<int> std_list_1;
+  std::list<int> std_list_2;
+  for (int i = 0; i < 100; ++i) {
+    my_list_1.push_back(i);
+    std_list_1.push_back(i);
+    my_list_2.push_back(-i);
+    std_list_2.push_back(-i);
+  }
+
+  my_list_1.splice(std::next(my_list_1.begin(), 37), my_list_2);
+  std_list_1.splice(std::next(std_list_1.begin(), 37), std_list_2);
+  my_list_1.push_back(1000);
+  std_list_1.push_back(1000);
+
+  EXPECT_TRUE(CompareUnrolledLists(my_list_1, std_list_1));
+  EXPECT_TRUE(my_list_2.empty());
+  EXPECT_EQ(my_list_2.begin(), my_list_2.end());
+}
+
+TEST(UnrolledListOperations, SpliceElementsAndRanges) {
+  s21::unrolled_list<int> my_list_1;
+  s21::unrolled_list<int> my_list_2;
+  std::list<int> std_list_1;
+  std::list<int> std_list_2;
+  for (int i = 0; i < 100; ++i) {
+    my_list_1.push_back(i);
+    std_list_1.push_back(i);
+    my_list_2.push_back(-i);
+    std_list_2.push_back(-i);
+  }
+
+  my_list_1.splice(std::next(my_list_1.begin(), 5), my_list_2,
+                   std::next(my_list_2.begin(), 7));
+  std_list_1.splice(std::next(std_list_1.begin(), 5), std_list_2,
+                    std::next(std_list_2.begin(), 7));
+  my_list_1.splice(std::next(my_list_1.begin(), 50), my_list_2,
+                   std::next(my_list_2.begin(), 3),
+                   std::next(my_list_2.begin(), 80));
+  std_list_1.splice(std::next(std_list_1.begin(), 50), std_list_2,
+                    std::next(std_list_2.begin(), 3),
+                    std::next(std_list_2.begin(), 80));
+  my_list_1.splice(my_list_1.end(), my_list_2, my_list_2.begin(),
+                   my_list_2.end());
+  std_list_1.splice(std_list_1.end(), std_list_2, std_list_2.begin(),
+                    std_list_2.end());
+
+  EXPECT_TRUE(CompareUnrolledLists(my_list_1, std_list_1));
+  EXPECT_TRUE(CompareUnrolledLists(my_list_2, std_list_2));
+
+  my_list_1.splice(std::next(my_list_1.begin(), 10), my_list_1,
+                   std::next(my_list_1.begin(), 120),
+                   std::next(my_list_1.begin(), 150));
+  std_list_1.splice(std::next(std_list_1.begin(), 10), std_list_1,
+                    std::next(std_list_1.begin(), 120),
+                    std::next(std_list_1.begin(), 150));
+  my_list_1.splice(my_list_1.end(), my_list_1, my_list_1.begin());
+  std_list_1.splice(std_list_1.end(), std_list_1, std_list_1.begin());
+
+  EXPECT_TRUE(CompareUnrolledLists(my_list_1, std_list_1));
+}
+
+TEST(UnrolledListModifiers, EmplaceAndRvalues) {
+  s21::unrolled_list<std::pair<std::string, int>> my_list;
+  std::string text(40, 'x');
+
+  my_list.emplace_back("b", 2);
+  my_list.emplace_front("a", 1);
+  my_list.push_back(std::make_pair(std::move(text), 3));
+  my_list.emplace(std::next(my_list.begin()), "ab", 4);
+  my_list.insert(my_list.end(), std::make_pair(std::string("c"), 5));
+
+  EXPECT_EQ(my_list.size(), 5);
+  EXPECT_EQ(my_list.front().first, "a");
+  EXPECT_EQ(std::next(my_list.begin())->second, 4);
+  EXPECT_EQ(std::next(my_list.begin(), 3)->first, std::string(40, 'x'));
+  EXPECT_EQ(my_list.back().second, 5);
+}
+
+TEST(UnrolledListOperations, RemoveIf) {
+  s21::unrolled_list<int> my_list;
+  std::list<int> std_list;
+  for (int i = 0; i < 300; ++i) {
+    my_list.push_back(i % 7);
+    std_list.push_back(i % 7);
+  }
+
+  EXPECT_EQ(my_list.remove(my_list.front()), 43);
+  std_list.remove(0);
+  EXPECT_EQ(my_list.remove_if([](int value) { return value > 4; }), 85);
+  std_list.remove_if([](int value) { return value > 4; });
+  EXPECT_TRUE(CompareUnrolledLists(my_list, std_list));
+
+  EXPECT_EQ(my_list.unique([](int kept, int value) { return value < kept; }),
+            126);
+  std_list.unique([](int kept, int value) { return value < kept; });
+  EXPECT_TRUE(CompareUnrolledLists(my_list, std_list));
+}
+
+TEST(UnrolledListOperations, Reverse) {
+  s21::unrolled_list<int> my_list;
+  std::list<int> std_list;
+  for (int i = 0; i < 150; ++i) {
+    my_list.push_back(i);
+    std_list.push_back(i);
+  }
+
+  my_list.reverse();
+  std_list.reverse();
+
+  EXPECT_TRUE(CompareUnrolledLists(my_list, std_list));
+  EXPECT_EQ(my_list.back(), 0);
+}
+
+TEST(UnrolledListOperations, Unique) {
+  s21::unrolled_list<int> my_list;
+  std::list<int> std_list;
+  for (int i = 0; i < 400; ++i) {
+    my_list.push_back(i / 3);
+    std_list.push_back(i / 3);
+  }
+
+  my_list.unique();
+  std_list.unique();
+
+  EXPECT_TRUE(CompareUnrolledLists(my_list, std_list));
+}
+
+TEST(UnrolledListOperations, SortIsStable) {
+  s21::unrolled_list<std::pair<int, int>> my_list;
+  std::list<std::pair<int, int>> std_list;
+  std::mt19937 gen(5);
+  for (int i = 0; i < 1000; ++i) {
+    std::pair<int, int> item(gen() % 20, i);
+    my_list.push_back(item);
+    std_list.push_back(item);
+  }
+  auto by_key = [](const auto& a, const auto& b) { return a.first < b.first; };
+
+  my_list.sort(by_key);
+  std_list.sort(by_key);
+
+  EXPECT_TRUE(CompareUnrolledLists(my_list, std_list));
+}
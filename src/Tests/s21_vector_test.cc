@@ -2,8 +2,64 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  explicit CountingAllocator(int *live) noexcept : live(live) {}
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U> &other) noexcept
+      : live(other.live) {}
+
+  T *allocate(size_t n) {
+    ++*live;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, size_t n) noexcept {
+    --*live;
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  bool operator==(const CountingAllocator &rhs) const noexcept {
+    return live == rhs.live;
+  }
+  bool operator!=(const CountingAllocator &rhs) const noexcept {
+    return live != rhs.live;
+  }
+
+  int *live;
+};
+
+// Counts live objects and throws once copies_left copies have been made.
+struct ThrowingCopy {
+  ThrowingCopy(int value, int *live, int *copies_left)
+      : value(value), live(live), copies_left(copies_left) {
+    ++*live;
+  }
+  ThrowingCopy(const ThrowingCopy &other)
+      : value(other.value), live(other.live), copies_left(other.copies_left) {
+    if ((*copies_left)-- == 0) {
+      throw std::runtime_error("copy");
+    }
+    ++*live;
+  }
+  ~ThrowingCopy() { --*live; }
+
+  int value;
+  int *live;
+  int *copies_left;
+};
+
 TEST(VectorConstructors, DefaultConstructor) {
   s21::vector<int> s21_vector;
   std::vector<int> std_vector;
@@ -243,6 +299,64 @@ TEST(VectorModifiers, EraseThrow) {
   EXPECT_ANY_THROW(s21_v.erase(s21_v.end()++));
 }
 
+TEST(VectorModifiers, EraseRange) {
+  s21::vector<std::string> s21_v = {"a", "b", "c", "d", "e", "f"};
+  std::vector<std::string> std_v = {"a", "b", "c", "d", "e", "f"};
+
+  auto s21_it = s21_v.erase(s21_v.begin() + 1, s21_v.begin() + 4);
+  auto std_it = std_v.erase(std_v.begin() + 1, std_v.begin() + 4);
+
+  EXPECT_EQ(*s21_it, *std_it);
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  for (size_t i = 0; i < std_v.size(); ++i) {
+    EXPECT_EQ(s21_v[i], std_v[i]);
+  }
+
+  s21_v.erase(s21_v.begin(), s21_v.begin());
+  EXPECT_EQ(s21_v.size(), 3);
+  s21_v.erase(s21_v.begin(), s21_v.end());
+  EXPECT_TRUE(s21_v.empty());
+}
+
+TEST(VectorModifiers, EraseRangeThrow) {
+  s21::vector<int> s21_v = {1, 2, 3, 4};
+
+  EXPECT_THROW(s21_v.erase(s21_v.begin() + 2, s21_v.begin() + 1),
+               std::out_of_range);
+  EXPECT_THROW(s21_v.erase(s21_v.begin(), s21_v.end() + 1), std::out_of_range);
+  EXPECT_EQ(s21_v.size(), 4);
+}
+
+TEST(VectorModifiers, EraseIf) {
+  s21::vector<std::string> s21_v;
+  std::vector<std::string> std_v;
+  for (int i = 0; i < 1000; ++i) {
+    s21_v.push_back(std::to_string(i));
+    std_v.push_back(std::to_string(i));
+  }
+
+  auto expired = [](const std::string &s) { return s.back() % 3 == 0; };
+  size_t removed = s21::erase_if(s21_v, expired);
+  std_v.erase(std::remove_if(std_v.begin(), std_v.end(), expired),
+              std_v.end());
+
+  EXPECT_EQ(removed, 1000 - std_v.size());
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  for (size_t i = 0; i < std_v.size(); ++i) {
+    EXPECT_EQ(s21_v[i], std_v[i]);
+  }
+}
+
+TEST(VectorModifiers, EraseValue) {
+  s21::vector<int> s21_v = {1, 2, 1, 3, 1, 4};
+
+  EXPECT_EQ(s21::erase(s21_v, 1), 3);
+  EXPECT_EQ(s21_v.size(), 3);
+  EXPECT_EQ(s21_v[0], 2);
+  EXPECT_EQ(s21_v[2], 4);
+  EXPECT_EQ(s21_v.remove_if([](int) { return false; }), 0);
+}
+
 TEST(VectorModifiers, PushBackEmpty) {
   s21::vector<int> s21_v;
   std::vector<int> std_v;
@@ -329,4 +443,315 @@ TEST(VectorModifiers, SwapFull) {
 
   EXPECT_EQ(s21_v_copy.size(), std_v_copy.size());
   EXPECT_EQ(s21_v_copy.capacity(), std_v_copy.capacity());
-}
\ No newline at end of file
+}
+TEST(VectorAllocator, AllocationsGoThroughAllocator) {
+  int live = 0;
+  {
+    CountingAllocator<std::string> alloc(&live);
+    s21::vector<std::string, CountingAllocator<std::string>> s21_v(alloc);
+
+    for (int i = 0; i < 100; ++i) {
+      s21_v.push_back(std::to_string(i));
+    }
+    EXPECT_EQ(live, 1);
+    EXPECT_EQ(s21_v[99], "99");
+    EXPECT_TRUE(s21_v.get_allocator() == alloc);
+  }
+  EXPECT_EQ(live, 0);
+}
+
+TEST(VectorAllocator, Propagation) {
+  int live_1 = 0;
+  int live_2 = 0;
+  using Alloc = CountingAllocator<int>;
+  {
+    s21::vector<int, Alloc> s21_v_1({1, 2, 3}, Alloc(&live_1));
+    s21::vector<int, Alloc> s21_v_2({4, 5}, Alloc(&live_2));
+
+    s21_v_2 = s21_v_1;
+    EXPECT_EQ(live_1, 2);
+    EXPECT_EQ(live_2, 0);
+    EXPECT_EQ(s21_v_2[2], 3);
+
+    s21::vector<int, Alloc> s21_v_3{Alloc(&live_2)};
+    s21_v_3.push_back(7);
+    s21_v_3.swap(s21_v_2);
+    EXPECT_TRUE(s21_v_3.get_allocator() == Alloc(&live_1));
+    EXPECT_TRUE(s21_v_2.get_allocator() == Alloc(&live_2));
+
+    s21_v_1 = std::move(s21_v_2);
+    EXPECT_EQ(s21_v_1[0], 7);
+    EXPECT_EQ(live_1, 1);
+    EXPECT_EQ(live_2, 1);
+  }
+  EXPECT_EQ(live_1, 0);
+  EXPECT_EQ(live_2, 0);
+}
+
+TEST(VectorAllocator, ThrowingCopyDuringReallocation) {
+  int allocations = 0;
+  int live = 0;
+  int copies_left = 100;
+  using Alloc = CountingAllocator<ThrowingCopy>;
+  {
+    s21::vector<ThrowingCopy, Alloc> s21_v{Alloc(&allocations)};
+    s21_v.reserve(4);
+    for (int i = 0; i < 4; ++i) {
+      s21_v.push_back(ThrowingCopy(i, &live, &copies_left));
+    }
+
+    copies_left = 2;
+    EXPECT_THROW(s21_v.reserve(100), std::runtime_error);
+    EXPECT_EQ(allocations, 1);
+    EXPECT_EQ(live, 4);
+    EXPECT_EQ(s21_v.capacity(), 4);
+    EXPECT_EQ(s21_v[3].value, 3);
+  }
+  EXPECT_EQ(allocations, 0);
+  EXPECT_EQ(live, 0);
+}
+
+TEST(VectorModifiers, InsertReturnsPosition) {
+  s21::vector<std::string> s21_v = {"a", "c"};
+  std::vector<std::string> std_v = {"a", "c"};
+
+  auto s21_it = s21_v.insert(++s21_v.begin(), "b");
+  auto std_it = std_v.insert(++std_v.begin(), "b");
+  s21_v.insert(s21_v.end(), s21_v[0]);
+  std_v.insert(std_v.end(), std_v[0]);
+
+  EXPECT_EQ(*s21_it, *std_it);
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  for (size_t i = 0; i < std_v.size(); ++i) {
+    EXPECT_EQ(s21_v[i], std_v[i]);
+  }
+}
+
+TEST(VectorGrowthPolicy, Golden) {
+  s21::vector<int, std::allocator<int>, s21::golden_growth> s21_v;
+
+  for (int i = 0; i < 65; ++i) {
+    s21_v.push_back(i);
+  }
+
+  EXPECT_EQ(s21_v.capacity(), 94);
+  EXPECT_EQ(s21_v[64], 64);
+}
+
+TEST(VectorGrowthPolicy, SizeClass) {
+  s21::vector<int, std::allocator<int>, s21::size_class_growth> s21_v;
+
+  s21_v.push_back(1);
+  EXPECT_EQ(s21_v.capacity(), 4);
+
+  for (int i = 0; i < 4; ++i) {
+    s21_v.insert(s21_v.begin(), i);
+  }
+  EXPECT_EQ(s21_v.capacity(), 8);
+  EXPECT_EQ(s21_v.front(), 3);
+  EXPECT_EQ(s21_v.back(), 1);
+}
+
+TEST(VectorGrowthPolicy, ReallocatingAllocator) {
+  s21::vector<long, s21::malloc_allocator<long>> s21_v;
+  std::vector<long> std_v;
+
+  for (long i = 0; i < 100000; ++i) {
+    s21_v.push_back(i * 3);
+    std_v.push_back(i * 3);
+  }
+  s21_v.shrink_to_fit();
+
+  EXPECT_EQ(s21_v.capacity(), s21_v.size());
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  for (size_t i = 0; i < std_v.size(); i += 997) {
+    EXPECT_EQ(s21_v[i], std_v[i]);
+  }
+}
+
+TEST(VectorGrowthPolicy, HugePageAllocator) {
+  using Alloc = s21::huge_page_allocator<int>;
+  s21::vector<int, Alloc> s21_v{Alloc(1 << 20, 256 << 20)};
+
+  for (int i = 0; i < (1 << 20); ++i) {
+    s21_v.push_back(i);
+  }
+  int *buffer = s21_v.data();
+  for (int i = 0; i < (4 << 20); ++i) {
+    s21_v.push_back(i);
+  }
+
+  if (Alloc::is_huge_page_backed(buffer)) {
+    EXPECT_EQ(s21_v.data(), buffer);
+  }
+  EXPECT_EQ(s21_v[(1 << 20) - 1], (1 << 20) - 1);
+  EXPECT_EQ(s21_v.back(), (4 << 20) - 1);
+
+  s21_v.clear();
+  s21_v.shrink_to_fit();
+  EXPECT_EQ(s21_v.capacity(), 0);
+}
+
+TEST(VectorBool, IsBitPacked) {
+  s21::vector<bool> s21_v(1000);
+
+  EXPECT_EQ(s21_v.bits().num_words(), 16);
+  EXPECT_EQ(s21_v.capacity(), 1024);
+}
+
+TEST(VectorBool, MatchesStd) {
+  s21::vector<bool> s21_v = {true, false, true};
+  std::vector<bool> std_v = {true, false, true};
+
+  for (int i = 0; i < 150; ++i) {
+    s21_v.push_back(i % 3 == 0);
+    std_v.push_back(i % 3 == 0);
+  }
+  s21_v.insert(s21_v.begin() + 2, false);
+  std_v.insert(std_v.begin() + 2, false);
+  s21_v.erase(s21_v.begin() + 70);
+  std_v.erase(std_v.begin() + 70);
+  s21_v.pop_back();
+  std_v.pop_back();
+  s21_v[5] = !s21_v[5];
+  std_v[5] = !std_v[5];
+  s21_v[6] = s21_v[0];
+  std_v[6] = std_v[0];
+
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  EXPECT_EQ(s21_v.front(), std_v.front());
+  EXPECT_EQ(s21_v.back(), std_v.back());
+  EXPECT_TRUE(std::equal(std_v.begin(), std_v.end(), s21_v.begin()));
+  EXPECT_EQ(s21_v.bits().count(),
+            static_cast<size_t>(std::count(std_v.begin(), std_v.end(), true)));
+  EXPECT_THROW(s21_v.at(s21_v.size()), std::out_of_range);
+  EXPECT_THROW(s21_v.erase(s21_v.end()), std::out_of_range);
+}
+
+TEST(VectorBool, EraseRangeAndIf) {
+  s21::vector<bool> s21_v;
+  std::vector<bool> std_v;
+  for (int i = 0; i < 200; ++i) {
+    s21_v.push_back(i % 5 < 2);
+    std_v.push_back(i % 5 < 2);
+  }
+
+  auto it = s21_v.erase(s21_v.begin() + 10, s21_v.begin() + 90);
+  std_v.erase(std_v.begin() + 10, std_v.begin() + 90);
+  EXPECT_EQ(it, s21_v.begin() + 10);
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  EXPECT_TRUE(std::equal(std_v.begin(), std_v.end(), s21_v.begin()));
+
+  size_t ones = s21_v.bits().count();
+  EXPECT_EQ(s21::erase(s21_v, true), ones);
+  EXPECT_EQ(s21_v.size(), 120 - ones);
+  EXPECT_EQ(s21_v.bits().count(), 0);
+
+  s21_v.push_back(true);
+  EXPECT_EQ(s21::erase_if(s21_v, [](bool bit) { return !bit; }), 120 - ones);
+  EXPECT_EQ(s21_v.size(), 1);
+  EXPECT_TRUE(s21_v.front());
+  EXPECT_EQ(s21::erase_if(s21_v, [](bool) { return false; }), 0);
+  EXPECT_EQ(s21::erase_if(s21_v, [](bool) { return true; }), 1);
+  EXPECT_TRUE(s21_v.empty());
+}
+
+TEST(VectorBool, FlipAndSwap) {
+  s21::vector<bool> s21_v_1(10);
+  s21::vector<bool> s21_v_2 = {true};
+
+  s21_v_1.flip();
+  s21_v_1.swap(s21_v_2);
+
+  EXPECT_EQ(s21_v_1.size(), 1);
+  EXPECT_EQ(s21_v_2.bits().count(), 10);
+  for (auto bit : s21_v_2) {
+    EXPECT_TRUE(bit);
+  }
+}
+
+TEST(VectorBuffers, ResizeUninitialized) {
+  s21::vector<char> s21_v;
+  const char text[] = "payload";
+
+  s21_v.resize_uninitialized(sizeof(text));
+  std::memcpy(s21_v.data(), text, sizeof(text));
+
+  EXPECT_EQ(s21_v.size(), sizeof(text));
+  EXPECT_STREQ(s21_v.data(), "payload");
+
+  s21_v.resize_uninitialized(3);
+  EXPECT_EQ(s21_v.size(), 3);
+  EXPECT_EQ(s21_v.capacity(), sizeof(text));
+  EXPECT_EQ(s21_v.back(), 'y');
+}
+
+static int freed_buffers = 0;
+
+static void FreeMallocBuffer(int *data, size_t) {
+  ++freed_buffers;
+  std::free(data);
+}
+
+TEST(VectorBuffers, AdoptFreesWithDeleter) {
+  freed_buffers = 0;
+  int *buffer = static_cast<int *>(std::malloc(4 * sizeof(int)));
+  buffer[0] = 1;
+  buffer[1] = 2;
+
+  {
+    s21::vector<int> s21_v;
+    s21_v.adopt(buffer, 2, 4, &FreeMallocBuffer);
+
+    EXPECT_EQ(s21_v.data(), buffer);
+    EXPECT_EQ(s21_v[1], 2);
+    s21_v.push_back(3);
+    s21_v.push_back(4);
+    EXPECT_EQ(s21_v.data(), buffer);
+    EXPECT_EQ(freed_buffers, 0);
+
+    s21_v.push_back(5);
+    EXPECT_NE(s21_v.data(), buffer);
+    EXPECT_EQ(freed_buffers, 1);
+    EXPECT_EQ(s21_v[4], 5);
+  }
+
+  EXPECT_EQ(freed_buffers, 1);
+  EXPECT_THROW(s21::vector<int>().adopt(nullptr, 1, 0, nullptr),
+               std::invalid_argument);
+}
+
+TEST(VectorBuffers, AdoptedBufferFreedOnDestruction) {
+  freed_buffers = 0;
+
+  {
+    s21::vector<int> s21_v = {7, 8};
+    s21_v.adopt(static_cast<int *>(std::malloc(sizeof(int))), 0, 1,
+                &FreeMallocBuffer);
+    s21::vector<int> s21_v_2(std::move(s21_v));
+    s21_v_2.push_back(1);
+  }
+
+  EXPECT_EQ(freed_buffers, 1);
+}
+
+TEST(VectorBuffers, ReleaseAndAdopt) {
+  s21::vector<std::string> s21_v_1 = {"a", "b", "c"};
+  const std::string *data = s21_v_1.data();
+
+  auto buffer = s21_v_1.release();
+  EXPECT_TRUE(s21_v_1.empty());
+  EXPECT_EQ(s21_v_1.capacity(), 0);
+  EXPECT_EQ(buffer.data, data);
+  EXPECT_EQ(buffer.size, 3);
+
+  s21::vector<std::string> s21_v_2;
+  s21_v_2.adopt(buffer.data, buffer.size, buffer.capacity, buffer.deleter);
+  EXPECT_EQ(s21_v_2.data(), data);
+  EXPECT_EQ(s21_v_2[2], "c");
+
+  s21::vector<char> s21_v_3 = {'x', 'y'};
+  auto raw = s21_v_3.release();
+  raw.deleter(raw.data, raw.capacity);
+  EXPECT_EQ(s21::vector<char>().release().deleter, nullptr);
+}
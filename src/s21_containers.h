@@ -1,11 +1,26 @@
 #ifndef S21_CONTAINERS_H
 #define S21_CONTAINERS_H
 
+#include "Containers/s21_arena_list.h"
+#include "Containers/s21_cow_vector.h"
+#include "Containers/s21_deque.h"
+#include "Containers/s21_dynamic_bitset.h"
+#include "Containers/s21_epoch.h"
+#include "Containers/s21_incremental_vector.h"
+#include "Containers/s21_intrusive_list.h"
 #include "Containers/s21_list.h"
+#include "Containers/s21_lock_free_list.h"
 #include "Containers/s21_map.h"
+#include "Containers/s21_mapped_vector.h"
+#include "Containers/s21_parallel.h"
 #include "Containers/s21_queue.h"
+#include "Containers/s21_radix_sort.h"
 #include "Containers/s21_set.h"
+#include "Containers/s21_simd.h"
+#include "Containers/s21_small_vector.h"
+#include "Containers/s21_soa_vector.h"
 #include "Containers/s21_stack.h"
+#include "Containers/s21_unrolled_list.h"
 #include "Containers/s21_vector.h"
 
 #endif  // S21_CONTAINERS_H